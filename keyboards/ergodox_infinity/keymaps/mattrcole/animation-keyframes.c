@@ -51,8 +51,10 @@
  *  reference is NULL, this means that activating that layer
  *  will not animate that specific element, rather, it will
  *  leave the previous element bitmap on screen.
- * Element bitmaps must follow the format discribed in
- * "<root>/quantum/visualizer/resources/lcd_logo.c".
+ * Element bitmaps are generated from the images in
+ * "<root>/quantum/visualizer/resources/images", see
+ * "<root>/quantum/visualizer/resources/generate-resources.py".
+ * Every image has to be exactly the size of its element.
  *
  * Several elements can be moving at once during a layer
  *  change. with each element's movement being independent of
@@ -72,11 +74,18 @@
  * (start|stop)_animation will be handled in this file.
 */
 
+#include <string.h>
+
 #include "animation-keyframes.h"
 #include "stdint.h"
 #include "resources/resources.h"
 #include "visualizer.h"
 #include "layers.h"
+#include "lcd-framebuffer.h"
+#include "visualizer-stats.h"
+#ifdef SERIAL_LINK_ENABLE
+#include "serial_link/system/serial_link.h"
+#endif
 
 // ENUM START ====================================================================================================================
 
@@ -106,136 +115,249 @@ typedef struct {
     Layers              layer;
 } ElementState;
 
-typedef struct {
-    uint8_t upper_left_coordinates[2], lower_right_coordinates[2];
-} BoundingBox;
-
 /**
- * ElementProperties
+ * ElementFrameOperation
  *
- * element: corresponding ElementList enum value of element
- * axis_of_movement: Either X or Y. If the animation is up or down,
- *      the value would be Y, left or right would be X
- * animation_motion_curve: the AnimationMotionCurveReference that
- *      the animation of the element should follow (read
- *      AnimationMotionCurveReference comments for more details)
- * direction_of_movement: direction of movement from rest position,
- *      negative if element moves left or up,
- *      positive if element moves right or down
- * bounding_box: zero-based coordinates of Element's boundary
- *      corners on the LCD screen.
+ * Everything needed to draw an element at a single frame, see
+ * ElementFrameOperations for how these are generated.
  *
+ * visible_position: zero-based coordinates of the upper left corner of
+ *      the part of the element's bounding box that shows the bitmap
+ * visible_area: size of that part given as delta x, delta y
+ * bitmap_position: zero-based coordinates where the upper left corner of
+ *      the element's bitmap ends up on screen, may be off-screen
+ * offset_in_pixels: the amount of pixels from the resting position
+ * skip: true if the element is drawn exactly like the previous frame
 */
 typedef struct {
-    ElementList              element;
-    Axis                     axis_of_movement;
-    AnimationMotionCurveType animation_motion_curve;
-    DirectionOfMovement      direction_of_movement;
-    BoundingBox              bounding_box;
-} ElementProperties;
+    uint8_t visible_position[2], visible_area[2];
+    int16_t bitmap_position[2];
+    uint8_t offset_in_pixels;
+    bool    skip;
+} ElementFrameOperation;
 
 // STRUCT STOP ===================================================================================================================
 
 // CONSTANTS START ===============================================================================================================
 
-#define FRAME_TIME 20 // ms per frame
 #define TOTAL_FRAMES 15
 #define RESTING 0
 #define PIXEL_PACKAGE_SIZE 8 // amount of pixels per byte. should be 8 unless you've drastically modified other things.
 
 static const gColor ScreenEraseColor = White;
 
+// the longest animation moves an element all the way off screen, and then back onto it
+#define MAX_ANIMATION_FRAMES (TOTAL_FRAMES * 2 + 1)
+
+// frames of the same length are described as a single run, see schedule_animation()
+#define MAX_ANIMATION_RUNS 8
+
+_Static_assert(MAX_ANIMATION_RUNS >= 2,
+    "Please increase MAX_ANIMATION_RUNS");
+
 // static const uint16_t ScreenSizeInBytes = (LCD_WIDTH / PIXEL_PACKAGE_SIZE) * LCD_HEIGHT;
 
-static const uint8_t AnimationMotionCurveReference[TOTAL_ANIMATION_MOTION_CURVE_TYPES][TOTAL_FRAMES + 1] = {
-    { RESTING, 1, 1, 2, 3, 4, 5, 6, 7, 9, 11, 13, 15, 18, 23, 31 },
-//    ^original position,       sliding out of frame...       ^ only 1 pixel showing
-    { RESTING, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 }
+/**
+ * Animation motion curves
+ *
+ * The amount of pixels an element has moved from its resting position at
+ * every frame, given as STEP(offset, offset of the previous frame) so that
+ * frames without any movement can be found at compile time.
+*/
+#define EXPONENTIAL_31_PIXEL_MOVEMENT_STEPS(STEP, ...) \
+    STEP(RESTING, RESTING, __VA_ARGS__) /* original position */ \
+    STEP(1,  RESTING, __VA_ARGS__) STEP(1,  1,  __VA_ARGS__) STEP(2,  1,  __VA_ARGS__) STEP(3,  2,  __VA_ARGS__) \
+    STEP(4,  3,  __VA_ARGS__) STEP(5,  4,  __VA_ARGS__) STEP(6,  5,  __VA_ARGS__) STEP(7,  6,  __VA_ARGS__) \
+    STEP(9,  7,  __VA_ARGS__) STEP(11, 9,  __VA_ARGS__) STEP(13, 11, __VA_ARGS__) STEP(15, 13, __VA_ARGS__) \
+    STEP(18, 15, __VA_ARGS__) STEP(23, 18, __VA_ARGS__) STEP(31, 23, __VA_ARGS__) /* only 1 pixel showing */
+
+#define LINEAR_16_PIXEL_MOVEMENT_STEPS(STEP, ...) \
+    STEP(RESTING, RESTING, __VA_ARGS__) \
+    STEP(1,  RESTING, __VA_ARGS__) STEP(2,  1,  __VA_ARGS__) STEP(3,  2,  __VA_ARGS__) STEP(4,  3,  __VA_ARGS__) \
+    STEP(5,  4,  __VA_ARGS__) STEP(6,  5,  __VA_ARGS__) STEP(7,  6,  __VA_ARGS__) STEP(8,  7,  __VA_ARGS__) \
+    STEP(9,  8,  __VA_ARGS__) STEP(10, 9,  __VA_ARGS__) STEP(11, 10, __VA_ARGS__) STEP(12, 11, __VA_ARGS__) \
+    STEP(13, 12, __VA_ARGS__) STEP(14, 13, __VA_ARGS__) STEP(15, 14, __VA_ARGS__)
+
+// every image comes both row ordered, resource_<name>, and in the LCD's page
+// order, resource_<name>_pages, either one can be used here
+static const resource_bitmap_t *const ElementResourceMap[TOTAL_LAYERS][TOTAL_ELEMENTS] = {
+    { &resource_logo_win, &resource_name_win, &resource_symbol_keyboard,   &resource_mode_mode }, //WIN layer
+    { &resource_logo_mac, &resource_name_mac, &resource_symbol_keyboard,   &resource_mode_mode }, //MAC layer
+    { &resource_logo_gam, &resource_name_gam, &resource_symbol_controller, &resource_mode_mode }, //GAM layer
+    { &resource_logo_cod, &resource_name_cod, &resource_symbol_controller, &resource_mode_cod  }, //COD layer
+    { NULL,              NULL,              &resource_symbol_keyboard,   &resource_mode_fn   }  //FN layer
 };
 
-static const uint8_t *const ElementResourceMap[TOTAL_LAYERS][TOTAL_ELEMENTS] = {
-    { resource_logo_win, resource_name_win, resource_symbol_keyboard,   resource_mode_mode }, //WIN layer
-    { resource_logo_mac, resource_name_mac, resource_symbol_keyboard,   resource_mode_mode }, //MAC layer
-    { resource_logo_win, resource_name_gam, resource_symbol_controller, resource_mode_mode }, //GAM layer
-    { resource_logo_cod, resource_name_cod, resource_symbol_controller, resource_mode_cod  }, //COD layer
-    { NULL,              NULL,              resource_symbol_keyboard,   resource_mode_fn   }  //FN layer
+/**
+ * How each layer is brought onto the screen. While gaming, scan latency
+ * matters more than the slides: SNAP layers are composed at rest and sent to
+ * the LCD in a single transfer, without a backlight fade, after which the
+ * visualizer has nothing left to wake up for. Without GAMING_MODE_ENABLE
+ * (VISUALIZER_GAMING_MODE = no) the gaming layers slide like the others.
+*/
+#ifdef GAMING_MODE_ENABLE
+#    define GAMING_LAYER_POLICY { SNAP,  true  }
+#else
+#    define GAMING_LAYER_POLICY { SLIDE, false }
+#endif
+
+static const LayerDisplayPolicy LayerDisplayPolicies[TOTAL_LAYERS] = {
+    { SLIDE, false }, //WIN layer
+    { SLIDE, false }, //MAC layer
+    GAMING_LAYER_POLICY, //GAM layer
+    GAMING_LAYER_POLICY, //COD layer
+    { SLIDE, false }  //FN layer
 };
 
-static const ElementProperties ElementPropertiesList[] = {
-    {
-        .axis_of_movement            = X,
-        .animation_motion_curve      = EXPONENTIAL_31_PIXEL_MOVEMENT,
-        .direction_of_movement       = NEGATIVE,
-        .bounding_box = {
-            .upper_left_coordinates  = { 0, 0 },
-            .lower_right_coordinates = { 31, 31 }
-        },
-        .element                       = LOGO
-    },
-    {
-        .axis_of_movement            = Y,
-        .animation_motion_curve      = LINEAR_16_PIXEL_MOVEMENT,
-        .direction_of_movement       = NEGATIVE,
-        .bounding_box = {
-            .upper_left_coordinates  = { 32, 0 },
-            .lower_right_coordinates = { 95, 15 }
-        },
-        .element                       = NAME
-    },
-    {
-        .axis_of_movement            = X,
-        .animation_motion_curve      = EXPONENTIAL_31_PIXEL_MOVEMENT,
-        .direction_of_movement       = POSITIVE,
-        .bounding_box = {
-            .upper_left_coordinates  = { 96, 0 },
-            .lower_right_coordinates = { 127, 31 }
-        },
-        .element                       = LAYER_SYMBOL
+/**
+ * Element properties
+ *
+ * Given as (element, axis_of_movement, animation_motion_curve,
+ *      direction_of_movement, upper left x, upper left y,
+ *      lower right x, lower right y)
+ *
+ * element: corresponding ElementList enum value of element
+ * axis_of_movement: Either X or Y. If the animation is up or down,
+ *      the value would be Y, left or right would be X
+ * animation_motion_curve: the motion curve that the animation of the
+ *      element should follow (read the animation motion curve comments
+ *      for more details)
+ * direction_of_movement: direction of movement from rest position,
+ *      negative if element moves left or up,
+ *      positive if element moves right or down
+ * coordinates: zero-based coordinates of Element's boundary
+ *      corners on the LCD screen.
+*/
+#define LOGO_PROPERTIES         LOGO,         X, EXPONENTIAL_31_PIXEL_MOVEMENT, NEGATIVE, 0,  0,  31,  31
+#define NAME_PROPERTIES         NAME,         Y, LINEAR_16_PIXEL_MOVEMENT,      NEGATIVE, 32, 0,  95,  15
+#define LAYER_SYMBOL_PROPERTIES LAYER_SYMBOL, X, EXPONENTIAL_31_PIXEL_MOVEMENT, POSITIVE, 96, 0,  127, 31
+#define MODE_PROPERTIES         MODE,         Y, LINEAR_16_PIXEL_MOVEMENT,      POSITIVE, 32, 16, 95,  31
+
+#define ON_AXIS(axis, movement_axis, value) ((axis) == (movement_axis) ? (value) : 0)
+
+#define ELEMENT_FRAME_OPERATION(offset, previous_offset, axis, direction, x0, y0, x1, y1) \
+    { \
+        .visible_position = { \
+            (x0) + ON_AXIS(X, axis, (direction) == POSITIVE ? (offset) : 0), \
+            (y0) + ON_AXIS(Y, axis, (direction) == POSITIVE ? (offset) : 0) \
+        }, \
+        .visible_area = { \
+            (x1) - (x0) + 1 - ON_AXIS(X, axis, offset), \
+            (y1) - (y0) + 1 - ON_AXIS(Y, axis, offset) \
+        }, \
+        .bitmap_position = { \
+            (x0) + ON_AXIS(X, axis, (direction) == POSITIVE ? (offset) : -(offset)), \
+            (y0) + ON_AXIS(Y, axis, (direction) == POSITIVE ? (offset) : -(offset)) \
+        }, \
+        .offset_in_pixels = (offset), \
+        .skip = (offset) == (previous_offset) \
     },
-    {
-        .axis_of_movement            = Y,
-        .animation_motion_curve      = LINEAR_16_PIXEL_MOVEMENT,
-        .direction_of_movement       = POSITIVE,
-        .bounding_box = {
-            .upper_left_coordinates  = { 32, 16 },
-            .lower_right_coordinates = { 95, 31 },
-        },
-        .element                       = MODE
-    }
+
+#define ELEMENT_FRAME_OPERATIONS(element, axis, curve, direction, x0, y0, x1, y1) \
+    [element] = { curve##_STEPS(ELEMENT_FRAME_OPERATION, axis, direction, x0, y0, x1, y1) },
+
+#define WITH_PROPERTIES(macro, properties) macro(properties)
+
+/**
+ * ElementFrameOperations
+ *
+ * A table of how every element is drawn at every frame, generated at
+ * compile time from the element properties and the motion curves, so the
+ * animation itself never has to work out positions, axes or directions.
+*/
+static const ElementFrameOperation ElementFrameOperations[TOTAL_ELEMENTS][TOTAL_FRAMES + 1] = {
+    WITH_PROPERTIES(ELEMENT_FRAME_OPERATIONS, LOGO_PROPERTIES)
+    WITH_PROPERTIES(ELEMENT_FRAME_OPERATIONS, NAME_PROPERTIES)
+    WITH_PROPERTIES(ELEMENT_FRAME_OPERATIONS, LAYER_SYMBOL_PROPERTIES)
+    WITH_PROPERTIES(ELEMENT_FRAME_OPERATIONS, MODE_PROPERTIES)
 };
 
+#ifdef ELEMENT_DELTAS_ENABLE
+/**
+ * ElementDeltaStep
+ *
+ * How the framebuffer changes when an element moves between two neighboring
+ * frames, as byte runs to XOR into it (see lcd_framebuffer_apply_delta).
+ * XOR being its own inverse, the same runs move the element back again.
+ *
+ * dirty_area: x, y, width, height of the area that changes
+ * size: bytes of runs, 0 if nothing changes
+*/
+typedef struct {
+    uint8_t        dirty_area[4];
+    uint16_t       size;
+    const uint8_t *runs;
+} ElementDeltaStep;
+
+/**
+ * ElementDeltas
+ *
+ * Every step of an element showing a single bitmap, generated at build time
+ * into element-deltas.h by
+ * "<root>/quantum/visualizer/resources/generate-resources.py".
+ *
+ * resource: the bitmap the deltas were rendered from
+ * steps: steps[frame] lies between frame and frame + 1
+ * appear: between an empty element and TOTAL_FRAMES
+*/
+typedef struct {
+    const resource_bitmap_t *resource;
+    ElementDeltaStep         steps[TOTAL_FRAMES];
+    ElementDeltaStep         appear;
+} ElementDeltas;
+
+#include "element-deltas.h"
+
+/**
+ * Catches element-deltas.h getting out of date with the elements. Both this
+ * and generate-resources.py reduce an element's bounding box, axis,
+ * direction and motion curve to the same number.
+*/
+#define ELEMENT_DELTAS_CHECKSUM_STEP(offset, previous_offset, ...) + ((offset) + 1u) * ((offset) + 1u) * ((previous_offset) + 7u)
+#define ELEMENT_DELTAS_CHECKSUM(element, axis, curve, direction, x0, y0, x1, y1) \
+    ((((((x0) * 131u + (y0)) * 131u + (x1)) * 131u + (y1)) * 4u + (axis) * 2u + (direction)) \
+        curve##_STEPS(ELEMENT_DELTAS_CHECKSUM_STEP))
+
+_Static_assert(ELEMENT_DELTAS_TOTAL_FRAMES == TOTAL_FRAMES, "Please regenerate element-deltas.h");
+_Static_assert(WITH_PROPERTIES(ELEMENT_DELTAS_CHECKSUM, LOGO_PROPERTIES) == ELEMENT_DELTAS_CHECKSUM_LOGO, "Please regenerate element-deltas.h");
+_Static_assert(WITH_PROPERTIES(ELEMENT_DELTAS_CHECKSUM, NAME_PROPERTIES) == ELEMENT_DELTAS_CHECKSUM_NAME, "Please regenerate element-deltas.h");
+_Static_assert(WITH_PROPERTIES(ELEMENT_DELTAS_CHECKSUM, LAYER_SYMBOL_PROPERTIES) == ELEMENT_DELTAS_CHECKSUM_LAYER_SYMBOL, "Please regenerate element-deltas.h");
+_Static_assert(WITH_PROPERTIES(ELEMENT_DELTAS_CHECKSUM, MODE_PROPERTIES) == ELEMENT_DELTAS_CHECKSUM_MODE, "Please regenerate element-deltas.h");
+
+#undef ELEMENT_DELTAS_CHECKSUM_STEP
+#undef ELEMENT_DELTAS_CHECKSUM
+#endif
+
+#undef ON_AXIS
+#undef ELEMENT_FRAME_OPERATION
+#undef ELEMENT_FRAME_OPERATIONS
+#undef WITH_PROPERTIES
+
 // CONSTANTS STOP ================================================================================================================
 
 // MUTABLE GLOBALS START =========================================================================================================
 
+// how many FRAME_TIME steps every frame of each run of current_animation advances the elements by
+static uint8_t run_steps[MAX_ANIMATION_RUNS];
+static keyframe_run_t animation_runs[MAX_ANIMATION_RUNS];
+
+// The slides take priority over the backlight color changes, should they
+// ever run out of animation slots
 static keyframe_animation_t current_animation = {
-    .loop = false
+    .loop = false,
+    .priority = 1,
+    .runs = animation_runs
 };
 
 static ElementState current_state[TOTAL_ELEMENTS], goal_state[TOTAL_ELEMENTS];
 
-// MUTABLE GLOBAL STOP ==========================================================================================================
+// when current_animation was scheduled, and how many of its steps were taken since
+static systemticks_t animation_start;
+static uint8_t steps_taken;
+// where current_animation was scheduled from, current_state is that plus steps_taken steps
+static ElementState animation_start_state[TOTAL_ELEMENTS];
 
-static ElementProperties get_element_properties(ElementList element) {
-    for(uint8_t i = 0; i < TOTAL_ELEMENTS; i++) {
-        if (ElementPropertiesList[i].element == element) return ElementPropertiesList[i];
-    }
-    return (ElementProperties){};
-}
-
-/* static ElementProperties get_element_properties(ElementList element) {
-    switch (element) {
-        case LOGO:
-            return Logo;
-        case NAME:
-            return Name;
-        case LAYER_SYMBOL:
-            return LayerSymbol;
-        case MODE:
-        default:
-            return Mode;
-    }
-} */
+// MUTABLE GLOBAL STOP ==========================================================================================================
 
 // determines if the goal state for a given element has been met
 static bool element_needs_animation_update(const ElementList element, const Layers goal_layer, const Layers current_layer, const uint8_t current_frame) {
@@ -253,191 +375,385 @@ static bool element_needs_animation_update(const ElementList element, const Laye
     return false;
 }
 
-static uint8_t get_frame_offset_in_pixels(const AnimationMotionCurveType curve_type, const uint8_t frame) {
-    return AnimationMotionCurveReference[curve_type][frame];
+/**
+ * Draws an element at the given frame in a single pass.
+ *
+ * previous_frame is the frame the element is currently drawn at. The redrawn
+ * area covers everything that is visible at either of the two frames, so any
+ * pixels the element leaves behind are erased by the same pass.
+*/
+void handle_slide_animation_common(const ElementList element, const uint8_t frame, const uint8_t previous_frame, const Layers active_layer) {
+    const ElementFrameOperation *const operation = &ElementFrameOperations[element][frame];
+    const ElementFrameOperation *const previous_operation = &ElementFrameOperations[element][previous_frame];
+    // whichever frame shows more of the element covers the other one
+    const ElementFrameOperation *const redraw = operation->offset_in_pixels < previous_operation->offset_in_pixels
+        ? operation
+        : previous_operation;
+
+    lcd_framebuffer_compose(
+        redraw->visible_position[X],
+        redraw->visible_position[Y],
+        redraw->visible_area[X],
+        redraw->visible_area[Y],
+        operation->bitmap_position[X] - redraw->visible_position[X],
+        operation->bitmap_position[Y] - redraw->visible_position[Y],
+        ElementResourceMap[active_layer][element],
+        ScreenEraseColor);
 }
 
-void get_target_start_position(uint8_t *const output, const Axis movement_axis, const uint8_t frame_pixel_offset, const DirectionOfMovement direction, const BoundingBox *const boundaries) {
-    output[X] = boundaries->upper_left_coordinates[X];
-    output[Y] = boundaries->upper_left_coordinates[Y];
-
-    if (direction == NEGATIVE) return;
+#ifdef ELEMENT_DELTAS_ENABLE
+static void apply_element_delta_step(const ElementDeltaStep *const step) {
+    if (step->size == 0) return;
 
-    output[movement_axis] += frame_pixel_offset;
+    lcd_framebuffer_apply_delta(step->runs, step->size, step->dirty_area[0], step->dirty_area[1], step->dirty_area[2], step->dirty_area[3]);
+}
 
-    return;
+// elements without a bitmap are empty and have no deltas
+static bool element_deltas_match(const ElementDeltas *const deltas, const resource_bitmap_t *const resource) {
+    return deltas == NULL ? resource == NULL : deltas->resource == resource;
 }
 
-void get_source_start_position(uint8_t *const output, const Axis movement_axis, const uint8_t frame_pixel_offset, const DirectionOfMovement direction, const BoundingBox *const boundaries) {
-    output[X] = 0;
-    output[Y] = 0;
+// returns false if there are no deltas for this change
+static bool apply_element_deltas(const ElementList element, const Layers previous_layer, const uint8_t previous_frame, const Layers layer, const uint8_t frame) {
+    const ElementDeltas *const previous_deltas = ElementDeltaMap[previous_layer][element];
+    const ElementDeltas *const deltas = ElementDeltaMap[layer][element];
 
-    if (direction == POSITIVE) return;
+    // ElementResourceMap changed since the deltas were generated
+    if (!element_deltas_match(previous_deltas, ElementResourceMap[previous_layer][element])) return false;
+    if (!element_deltas_match(deltas, ElementResourceMap[layer][element])) return false;
 
-    output[movement_axis] = frame_pixel_offset;
+    if (previous_deltas != deltas) {
+        // bitmaps are only ever swapped while the element is all the way out
+        if (previous_frame != TOTAL_FRAMES || frame != TOTAL_FRAMES) return false;
 
-    return;
-}
+        if (previous_deltas != NULL) apply_element_delta_step(&previous_deltas->appear);
+        if (deltas != NULL) apply_element_delta_step(&deltas->appear);
 
-void get_target_fill_area(uint8_t *const output, const Axis movement_axis, const uint8_t frame_pixel_offset, const BoundingBox *const boundaries) {
-    const Axis static_axis = movement_axis == X ? Y : X;
+        return true;
+    }
 
-    const uint8_t source_dimensions[2] = { // Remember: fill area is not zero based, it is total pixles
-      boundaries->lower_right_coordinates[X] - boundaries->upper_left_coordinates[X] + 1,
-      boundaries->lower_right_coordinates[Y] - boundaries->upper_left_coordinates[Y] + 1
-    };
+    if (deltas == NULL || frame == previous_frame) return true;
 
-    output[static_axis] = source_dimensions[static_axis];
+    const uint8_t first_frame = frame < previous_frame ? frame : previous_frame;
+    const uint8_t last_frame = frame < previous_frame ? previous_frame : frame;
 
-    output[movement_axis] = source_dimensions[movement_axis] - frame_pixel_offset;
+    // XOR steps cancel out in any order, so skipped frames are simply applied
+    // one after the other
+    for (uint8_t step = first_frame; step < last_frame; step++) {
+        apply_element_delta_step(&deltas->steps[step]);
+    }
 
-    return;
+    return true;
 }
+#endif
 
 /**
- * @param[out] target_start_position[2] zero-based index of pixel where drawing should begin
- * @param[out] target_fill_area[2]      area to fill given as delta x, delta y coordinate pair
- * @param[out] source_start_position[2] zero-based index of pixel where element source picture
- *                                          should start to be drawn from
- * @param      properties                   properties of element you are drawing
- * @param      frame_offset_in_pixels   the amount of pixels from the resting position of the
- *                                          element
+ * Moves an element from previous_frame of previous_layer's bitmap to frame
+ * of layer's bitmap. The frames don't have to be neighbors, animation_routine()
+ * drops the ones it is too late for, and the layers differ when the bitmaps
+ * were swapped at TOTAL_FRAMES on the way.
+ *
+ * Uses the precomputed deltas when there are any, which only works because
+ * the framebuffer always shows every element exactly at its current_state.
+ * The swap is only covered by them if it happened right at TOTAL_FRAMES.
 */
-uint8_t get_draw_information(uint8_t *const target_start_position, uint8_t *const target_fill_area, uint8_t *const source_start_position, const ElementProperties *const properties, uint8_t frame_offset_in_pixels) {
-    const DirectionOfMovement direction = properties->direction_of_movement;
-    const BoundingBox boundaries = properties->bounding_box;
-    const Axis movement_axis = properties->axis_of_movement;
+static void draw_element(const ElementList element, const Layers previous_layer, const uint8_t previous_frame, const Layers layer, const uint8_t frame) {
+#ifdef ELEMENT_DELTAS_ENABLE
+    if (apply_element_deltas(element, previous_layer, previous_frame, layer, frame)) return;
+#endif
 
-    get_target_start_position(target_start_position, movement_axis, frame_offset_in_pixels, direction, &boundaries);
-    get_target_fill_area(target_fill_area, movement_axis, frame_offset_in_pixels, &boundaries);
-    get_source_start_position(source_start_position, movement_axis, frame_offset_in_pixels, direction, &boundaries);
-
-    return boundaries.lower_right_coordinates[X] - boundaries.upper_left_coordinates[X] + 1;
+    handle_slide_animation_common(element, frame, previous_frame, layer);
 }
 
-void handle_slide_animation_common(const ElementList element, const uint8_t frame, const Layers active_layer) {
-    const ElementProperties properties = get_element_properties(element);
-    const uint8_t frame_offset_in_pixels = get_frame_offset_in_pixels(properties.animation_motion_curve, frame);
-    const uint8_t *source = ElementResourceMap[active_layer][element];
+// returns true if the element changes on screen
+static bool handle_slide_in_animation(const ElementList element, ElementState *const state) {
+    const uint8_t next_frame = state->frame - 1;
+    const uint8_t current_frame = state->frame;
+    const bool element_moves = !ElementFrameOperations[element][current_frame].skip;
 
-    uint8_t screen_start_position[2];
-    uint8_t total_fill_area[2];
-    uint8_t bitmap_start_position[2];
+    state->frame = next_frame;
 
-    const uint8_t bitmap_row_length =
-      get_draw_information(screen_start_position, total_fill_area, bitmap_start_position, &properties, frame_offset_in_pixels);
+    return element_moves;
+}
 
+// returns true if the element changes on screen
+static bool handle_slide_out_animation(const ElementList element, ElementState *const state) {
+    const uint8_t current_frame = state->frame;
+    const uint8_t next_frame = current_frame + 1 > TOTAL_FRAMES
+        ? current_frame
+        : current_frame + 1;
+    const bool element_moves = next_frame != current_frame && !ElementFrameOperations[element][next_frame].skip;
+
+    if (next_frame == current_frame) {
+        //technically done with the slide-out animation, switching to a slide-in animation
+        state->layer = goal_state[element].layer;
+    }
 
-    gdispGBlitArea(GDISP,\
-        screen_start_position[X],\
-        screen_start_position[Y],\
-        total_fill_area[X],\
-        total_fill_area[Y],\
-        bitmap_start_position[X],\
-        bitmap_start_position[Y],\
-        bitmap_row_length,\
-        (const gPixel*)source);
+    state->frame = next_frame;
+
+    return element_moves || next_frame == current_frame;
 }
 
-static uint8_t get_pixel_delta_between_frames(const uint8_t earlier_frame, const uint8_t later_frame, ElementList element) {
-    AnimationMotionCurveType motion_curve_type = get_element_properties(element).animation_motion_curve;
-    const uint8_t* motion_curve = AnimationMotionCurveReference[motion_curve_type];
-    return motion_curve[later_frame] - motion_curve[earlier_frame];
+/**
+ * Moves every element one frame closer to its goal_state, without drawing
+ * anything. Returns true if anything changes on screen.
+*/
+static bool advance_elements(ElementState *const states) {
+    bool changed = false;
+
+    for(ElementList element = 0; element < TOTAL_ELEMENTS; element++) {
+        if (!element_needs_animation_update(element, goal_state[element].layer, states[element].layer, states[element].frame)) continue;
+
+        if (states[element].layer == goal_state[element].layer) changed |= handle_slide_in_animation(element, &states[element]);
+
+        else changed |= handle_slide_out_animation(element, &states[element]);
+    }
+
+    return changed;
 }
 
-void handle_slide_in_animation(const ElementList element) {
-    const uint8_t next_frame = current_state[element].frame - 1;
-    const uint8_t current_frame = current_state[element].frame;
-    const uint8_t current_layer = current_state[element].layer;
-    const uint8_t pixel_delta = get_pixel_delta_between_frames(next_frame, current_frame, element);
+static bool elements_need_update(const ElementState *const states) {
+    for(ElementList element = 0; element < TOTAL_ELEMENTS; element++) {
+        if (element_needs_animation_update(element, goal_state[element].layer, states[element].layer, states[element].frame)) return true;
+    }
+
+    return false;
+}
 
-    if (pixel_delta != 0) handle_slide_animation_common(element, next_frame, current_layer);
+/**
+ * Returns how many steps of the animation are due by time. That's at least
+ * the steps of the frames up to current_frame, plus the steps of every later
+ * frame whose start the visualizer thread already missed.
+*/
+static uint8_t get_steps_due(const int current_frame, const systemticks_t time) {
+    const systemticks_t elapsed = time - animation_start;
+    systemticks_t frame_start = 0;
+    uint8_t steps = 0;
+    int frame = 0;
+
+    for (uint8_t run = 0; run < current_animation.num_runs; run++) {
+        for (int repeat = 0; repeat < animation_runs[run].repeat; repeat++, frame++) {
+            if (frame > current_frame && frame_start > elapsed) return steps;
+
+            steps += run_steps[run];
+            frame_start += animation_runs[run].length;
+        }
+    }
 
-    current_state[element].frame = next_frame;
+    return steps;
 }
 
+// when frame of the animation ends, counted from animation_start
+static systemticks_t get_frame_end(const int frame) {
+    systemticks_t frame_end = 0;
+    int next_frame = 0;
+
+    for (uint8_t run = 0; run < current_animation.num_runs && next_frame <= frame; run++) {
+        for (int repeat = 0; repeat < animation_runs[run].repeat && next_frame <= frame; repeat++, next_frame++) {
+            frame_end += animation_runs[run].length;
+        }
+    }
+
+    return frame_end;
+}
 
 /**
- * @param[out] erase_start_position[2] zero-based index of pixel where erasing should begin
- * @param[out] erase_fill_area[2]      area to erase given as delta x, delta y coordinate pair
- * @param      clean_up_frame          the most recently rendered frame
- * @param      element                 the element's enumeration index
+ * Brings the screen to where the animation should be by now. Normally that's
+ * the steps of this frame, the first one changes the screen and the rest are
+ * the steps without any movement merged into it by schedule_animation().
+ *
+ * When the visualizer thread was starved the frames it missed are dropped:
+ * the elements are moved ahead without drawing and then drawn once, right
+ * where they should be. The keyframe animation still calls this for every
+ * frame it missed, those calls find nothing left to do. That keeps the
+ * duration of the animation the same, however busy the keyboard is.
+ *
+ * Every frame ends when it would have from animation_start on, not a frame
+ * length after this half got to it. Both halves then wake up for the same
+ * frames at the same time, however late the slave started the animation.
 */
-void get_erase_information(uint8_t *const erase_start_position, uint8_t *const erase_fill_area, const uint8_t clean_up_frame, ElementList element) {
-    const ElementProperties properties = get_element_properties(element);
-    const uint8_t *element_upper_left = properties.bounding_box.upper_left_coordinates;
-    const uint8_t *element_lower_right = properties.bounding_box.lower_right_coordinates;
-    const Axis movement_axis = properties.axis_of_movement;
-    const Axis static_axis   = movement_axis == X ? Y : X;
-    const DirectionOfMovement movement_direction = properties.direction_of_movement;
-    const uint8_t clean_up_frame_pixel_offset = get_frame_offset_in_pixels(properties.animation_motion_curve, clean_up_frame);
-    const uint8_t pixel_delta = get_pixel_delta_between_frames(clean_up_frame - 1, clean_up_frame, properties.animation_motion_curve);
-
-    erase_start_position[static_axis] = element_upper_left[static_axis];
-    erase_start_position[movement_axis] = movement_direction == POSITIVE
-        ? element_upper_left[movement_axis]
-        : element_lower_right[movement_axis] - clean_up_frame_pixel_offset;
-
-    erase_fill_area[static_axis] = element_lower_right[static_axis] - element_upper_left[static_axis] + 1;
-    erase_fill_area[movement_axis] = pixel_delta + 1;
-
-    return;
+bool animation_routine(keyframe_animation_t* animation, visualizer_state_t* state) {
+    VISUALIZER_STATS_TIMER_START(start_time);
+
+    // the keyframe animation only calls frames it woke up too late for at
+    // their very end, when it's already in the next one
+    if (animation->first_update_of_frame && animation->last_update_of_frame) VISUALIZER_STATS_INCREMENT(missed_frames);
+
+    if (animation->first_update_of_frame && !animation->last_update_of_frame) {
+        const int32_t time_left = get_frame_end(animation->current_frame) - (gfxSystemTicks() - animation_start);
+
+        animation->time_left_in_frame = time_left > 0 ? time_left : 0;
+    }
+
+    const uint8_t steps_due = get_steps_due(animation->current_frame, gfxSystemTicks());
+
+    if (steps_taken < steps_due) {
+        ElementState drawn_state[TOTAL_ELEMENTS];
+
+        memcpy(drawn_state, current_state, sizeof(drawn_state));
+
+        for (; steps_taken < steps_due; steps_taken++) advance_elements(current_state);
+
+        for (ElementList element = 0; element < TOTAL_ELEMENTS; element++) {
+            const ElementState *const drawn = &drawn_state[element];
+            const ElementState *const current = &current_state[element];
+
+            if (drawn->layer == current->layer && drawn->frame == current->frame) continue;
+
+            draw_element(element, drawn->layer, drawn->frame, current->layer, current->frame);
+        }
+    }
+
+    VISUALIZER_STATS_INCREMENT(animation_routine_calls);
+    VISUALIZER_STATS_TIMER_STOP(start_time, animation_routine_time, animation_routine_max_time);
+
+    return false;
 }
 
-void handle_slide_out_clean_up(const ElementList element, const uint8_t clean_up_frame) {
-    uint8_t erase_start_position[2], erase_fill_area[2];
+/**
+ * Appends a frame of steps to the runs of current_animation. Frames are
+ * mostly a single step, so there are only ever a few runs. Should they run
+ * out anyway, the last run is made of single steps, and every remaining
+ * step gets a frame of its own in it.
+*/
+static void add_scheduled_frame(const uint8_t steps) {
+    const int last_run = current_animation.num_runs - 1;
+
+    if (last_run >= 0 && run_steps[last_run] == steps) {
+        animation_runs[last_run].repeat++;
+        return;
+    }
 
-    get_erase_information(erase_start_position, erase_fill_area, clean_up_frame, element);
+    if (last_run == MAX_ANIMATION_RUNS - 1) {
+        animation_runs[last_run].repeat += steps;
+        return;
+    }
 
-    if(erase_fill_area[X] == 0 || erase_fill_area[Y] == 0) return;
+    const bool is_last_run = last_run + 1 == MAX_ANIMATION_RUNS - 1;
 
-    gdispGFillArea(
-        GDISP,
-        erase_start_position[X],
-        erase_start_position[Y],
-        erase_fill_area[X],
-        erase_fill_area[Y],
-        ScreenEraseColor
-    );
+    run_steps[last_run + 1] = is_last_run ? 1 : steps;
+    animation_runs[last_run + 1] = (keyframe_run_t){
+        .length = gfxMillisecondsToTicks(FRAME_TIME * run_steps[last_run + 1]),
+        .function = &animation_routine,
+        .repeat = is_last_run ? steps : 1
+    };
+    current_animation.num_runs++;
 }
 
-void handle_slide_out_animation(const ElementList element) {
-    const uint8_t current_frame = current_state[element].frame;
-    const uint8_t next_frame = current_frame + 1 > TOTAL_FRAMES
-        ? current_frame
-        : current_frame + 1;
-    const uint8_t pixel_delta = get_pixel_delta_between_frames(current_frame, next_frame, element);
+/**
+ * Plans the frames of current_animation, from current_state to goal_state.
+ *
+ * The animation is played ahead without drawing, one FRAME_TIME step at a
+ * time. Every step that changes the screen starts a new frame, steps that
+ * don't (repeated offsets in a motion curve, coming to rest at the end) are
+ * merged into the frame before them. The visualizer thread then sleeps
+ * through them instead of waking up to do nothing.
+*/
+static void schedule_animation(const systemticks_t start) {
+    ElementState planned_state[TOTAL_ELEMENTS];
+    uint8_t frame_steps = 0;
+
+    memcpy(planned_state, current_state, sizeof(planned_state));
+    memcpy(animation_start_state, current_state, sizeof(animation_start_state));
+    current_animation.num_runs = 0;
+
+    for (uint8_t step = 0; step < MAX_ANIMATION_FRAMES && elements_need_update(planned_state); step++) {
+        if (advance_elements(planned_state) && frame_steps > 0) {
+            add_scheduled_frame(frame_steps);
+            frame_steps = 0;
+        }
 
-    if (next_frame == current_frame) {
-        //technically done with the slide-out animation, switching to a slide-in animation
-        current_state[element].layer = goal_state[element].layer;
+        frame_steps++;
+    }
+
+    if (frame_steps > 0) add_scheduled_frame(frame_steps);
+
+    const systemticks_t now = gfxSystemTicks();
+    const systemticks_t lag = now - start;
+
+    // The clocks of the two halves are only known to a tick or so, a start
+    // that's still ahead would look like an animation that's long overdue
+    if ((int32_t)lag < 0) {
+        animation_start = now;
+    } else {
+        animation_start = start;
+        VISUALIZER_STATS_ADD(animation_start_lag, lag);
+        VISUALIZER_STATS_MAX(animation_start_max_lag, lag);
     }
 
-    if (pixel_delta || next_frame == current_frame) handle_slide_animation_common(element, next_frame, current_state[element].layer);
+    steps_taken = 0;
+}
 
-    if (current_frame != next_frame) handle_slide_out_clean_up(element, next_frame);
+const LayerDisplayPolicy *get_layer_display_policy(Layers layer) {
+    static const LayerDisplayPolicy other_layers = { SLIDE, false };
 
-    current_state[element].frame = next_frame;
+    return layer < TOTAL_LAYERS ? &LayerDisplayPolicies[layer] : &other_layers;
 }
 
-bool animation_routine(keyframe_animation_t* animation, visualizer_state_t* state) {
-    for(ElementList element = 0; element < TOTAL_ELEMENTS; element++) {
-        if (!element_needs_animation_update(element, goal_state[element].layer, current_state[element].layer, current_state[element].frame)) continue;
+/**
+ * Puts every element at rest on its goal layer at once. The whole screen is
+ * composed in the framebuffer, so it goes to the LCD as a single transfer.
+*/
+static void snap_elements_to_goal(void) {
+    stop_keyframe_animation(&current_animation);
+    current_animation.num_runs = 0;
+    steps_taken = 0;
+
+    lcd_framebuffer_clear(ScreenEraseColor);
 
-        if (current_state[element].layer == goal_state[element].layer) handle_slide_in_animation(element);
+    for (ElementList element = 0; element < TOTAL_ELEMENTS; element++) {
+        current_state[element].layer = goal_state[element].layer;
+        current_state[element].frame = RESTING;
 
-        else handle_slide_out_animation(element);
+        if (ElementResourceMap[current_state[element].layer][element] != NULL) {
+            handle_slide_animation_common(element, RESTING, RESTING, current_state[element].layer);
+        }
     }
+
+    memcpy(animation_start_state, current_state, sizeof(animation_start_state));
+}
+
+// true on the slave, whose animations follow the master's
+static bool is_following_master(void) {
+#ifdef SERIAL_LINK_ENABLE
+    return is_serial_link_connected();
+#else
     return false;
+#endif
 }
 
-void initialize_my_animation_handler(Layers layer) {
-    for (uint8_t i = 0; i < TOTAL_FRAMES * 2 + 1; i++) {
-        current_animation.frame_functions[i] = &animation_routine;
-        current_animation.frame_lengths[i] = gfxMillisecondsToTicks(FRAME_TIME);
+/**
+ * Brings current_state, and the screen, to where current_animation had the
+ * elements at time, so that both halves plan the next animation from the
+ * same elements. The slave learns about a layer change later than the
+ * master, and may have moved on since. The master only ever catches up,
+ * it's the one the slave follows, and it's only ahead of time when its
+ * thread was starved, going back would make the elements jump.
+*/
+static void rewind_elements_to(const systemticks_t time) {
+    ElementState state_at_time[TOTAL_ELEMENTS];
+    const uint8_t steps = (int32_t)(time - animation_start) < 0 ? 0 : get_steps_due(-1, time);
+
+    if (steps < steps_taken && !is_following_master()) return;
+
+    memcpy(state_at_time, animation_start_state, sizeof(state_at_time));
+
+    for (uint8_t step = 0; step < steps; step++) advance_elements(state_at_time);
+
+    for (ElementList element = 0; element < TOTAL_ELEMENTS; element++) {
+        const ElementState *const current = &current_state[element];
+        const ElementState *const at_time = &state_at_time[element];
+
+        if (current->layer == at_time->layer && current->frame == at_time->frame) continue;
+
+        draw_element(element, current->layer, current->frame, at_time->layer, at_time->frame);
     }
 
-    const uint8_t frames_needed = TOTAL_FRAMES + 1;
+    memcpy(current_state, state_at_time, sizeof(current_state));
+    steps_taken = steps;
+}
+
+void initialize_my_animation_handler(Layers layer) {
     bool animation_needed = false;
 
     for(ElementList element = 0; element < TOTAL_ELEMENTS; element++) {
@@ -453,44 +769,44 @@ void initialize_my_animation_handler(Layers layer) {
 
     }
 
-    gdispGClear(GDISP, ScreenEraseColor);
+    memcpy(animation_start_state, current_state, sizeof(animation_start_state));
+
+    if (get_layer_display_policy(layer)->transition == SNAP) {
+        snap_elements_to_goal();
+        return;
+    }
+
+    lcd_framebuffer_clear(ScreenEraseColor);
+
+    // Elements start out all the way off screen. Drawing them there keeps the
+    // framebuffer in line with current_state. Like everything else drawn into
+    // it, it only reaches the LCD together with the first frame of the
+    // animation, when the visualizer calls user_visualizer_flush().
+    for(ElementList element = 0; element < TOTAL_ELEMENTS; element++) {
+        if (ElementResourceMap[layer][element] != NULL) handle_slide_animation_common(element, TOTAL_FRAMES, TOTAL_FRAMES, layer);
+    }
 
     if (animation_needed) {
-        current_animation.num_frames = frames_needed;
+        schedule_animation(gfxSystemTicks());
 
         start_keyframe_animation(&current_animation);
     }
 }
 
-void update_keyframe_animation(uint8_t needed_frames) {
-    stop_keyframe_animation(&current_animation);
+// starts current_animation over from start, towards the new goal_state
+void update_keyframe_animation(const systemticks_t start) {
+    VISUALIZER_STATS_INCREMENT(animation_restarts);
 
-    current_animation.num_frames = needed_frames;
+    schedule_animation(start);
 
     start_keyframe_animation(&current_animation);
 }
 
-// this function will never return zero, only call if you know that an animation is needed
-static uint8_t get_needed_element_frame_count(const ElementList element, const Layers current_layer, const Layers goal_layer, const uint8_t current_frame) {
-    const uint8_t element_has_animation_on_current_layer = ElementResourceMap[current_layer][element] == NULL ? 0 : 1;
-    const uint8_t resting_frame = 1;
-
-    if (!element_has_animation_on_current_layer) {
-        return TOTAL_FRAMES + resting_frame;
-    }
-
-    const bool need_to_move_off_screen = current_layer != goal_layer;
-    const uint8_t move_off_of_screen_frames = need_to_move_off_screen ? TOTAL_FRAMES - current_frame : 0;
-    const uint8_t move_on_screen_frames = need_to_move_off_screen ? TOTAL_FRAMES : current_frame;
-
-    return move_off_of_screen_frames + move_on_screen_frames + resting_frame;
-}
-
 void update_element_layer_states(const ElementList element, const Layers new_layer) {
     ElementState *const current = &current_state[element];
     ElementState *const goal = &goal_state[element];
-    const uint8_t *const new_layer_resource = ElementResourceMap[new_layer][element];
-    const uint8_t *const current_resource = ElementResourceMap[current->layer][element];
+    const resource_bitmap_t *const new_layer_resource = ElementResourceMap[new_layer][element];
+    const resource_bitmap_t *const current_resource = ElementResourceMap[current->layer][element];
 
     if (current->layer == new_layer && goal->layer == new_layer) return;
 
@@ -513,23 +829,34 @@ void update_element_layer_states(const ElementList element, const Layers new_lay
  *  Should only be called on a layer change. Handles ALL lcd animations internally.
  *  (but not backlight)
 */
-void update_my_animation_handler(Layers new_goal_layer) {
-    uint8_t total_frames_needed = 0;
+void update_my_animation_handler(Layers new_goal_layer, systemticks_t start) {
+    bool animation_needed = false;
+
+    rewind_elements_to(start);
 
     for (ElementList element = 0; element < TOTAL_ELEMENTS; element++) {
         const uint8_t current_frame = current_state[element].frame;
         const uint8_t current_layer = current_state[element].layer;
 
-        if (element_needs_animation_update(element, new_goal_layer, current_layer, current_frame)) {
-            const uint8_t element_frames_needed = get_needed_element_frame_count(element, current_layer, new_goal_layer, current_frame);
-
-            if (element_frames_needed > total_frames_needed) total_frames_needed = element_frames_needed;
-        }
+        if (element_needs_animation_update(element, new_goal_layer, current_layer, current_frame)) animation_needed = true;
 
         update_element_layer_states(element, new_goal_layer);
     }
 
-    if (total_frames_needed) update_keyframe_animation(total_frames_needed);
+    if (!animation_needed) return;
+
+    if (get_layer_display_policy(new_goal_layer)->transition == SNAP) snap_elements_to_goal();
+
+    else update_keyframe_animation(start);
+}
+
+bool my_animation_handler_is_idle(void) {
+    for (ElementList element = 0; element < TOTAL_ELEMENTS; element++) {
+        if (current_state[element].frame != RESTING) return false;
+        if (current_state[element].layer != goal_state[element].layer) return false;
+    }
+
+    return true;
 }
 
 #undef PIXEL_PACKAGE_SIZE
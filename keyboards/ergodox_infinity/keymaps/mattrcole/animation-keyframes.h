@@ -1,8 +1,30 @@
 #pragma once
+#include <stdbool.h>
+#include "gfx.h"
 #include "layers.h"
 
+#define FRAME_TIME 20 // ms per frame
+
+typedef enum {
+    SLIDE, // elements slide out and back in, the backlight color fades
+    SNAP   // elements are drawn at rest at once, the backlight color is set at once
+} LayerTransition;
+
+typedef struct {
+    LayerTransition transition;
+    bool pause_leds; // matrix_scan_user only updates the leds when entering the layer
+} LayerDisplayPolicy;
+
+// how the given layer is brought onto the screen
+const LayerDisplayPolicy *get_layer_display_policy(Layers layer);
+
 // Should be called upon visualizer initialization
 void initialize_my_animation_handler(Layers);
 
-// should be called every time there is a state change.
-void update_my_animation_handler(Layers);
+// should be called every time there is a state change. The animation runs as
+// if it had started at start, so that both halves of the keyboard show the
+// same frame even though the slave learns about the change later.
+void update_my_animation_handler(Layers, systemticks_t start);
+
+// true once every element has come to rest on its goal layer
+bool my_animation_handler_is_idle(void);
@@ -0,0 +1,5 @@
+#pragma once
+
+// The slides of this keymap are described as runs of frames, see
+// animation-keyframes.c, none of its animations has more than 8 keyframes
+#define MAX_VISUALIZER_KEY_FRAMES 8
@@ -0,0 +1,91 @@
+/**
+ * Keeps track of which parts of the LCD have been drawn to during a single
+ * update of the visualizer.
+ *
+ * Every added area is merged with any tracked region it overlaps or touches,
+ * so by the end of an update the list holds the smallest set of rectangles
+ * that can each be copied to the display driver in one go, see
+ * lcd_framebuffer_flush(). If the list ever fills up, the new area is merged
+ * into the first region, which is always correct, just not as tight.
+ *
+ * The regions only decide what is copied into the driver's buffer. uGFX can
+ * only send the whole of that buffer to the LCD, which the visualizer thread
+ * does with its single gdispGFlush() after every update. Nothing here flushes
+ * on its own, that would send the same frame twice.
+*/
+
+#include "dirty-regions.h"
+
+#define UPPER_LEFT(region, axis) ((region)->upper_left_coordinates[axis])
+#define LOWER_RIGHT(region, axis) ((region)->lower_right_coordinates[axis])
+
+static DirtyRegion regions[MAX_DIRTY_REGIONS];
+static uint8_t total_regions = 0;
+
+static bool axis_overlaps_or_touches(const DirtyRegion *const a, const DirtyRegion *const b, const uint8_t axis) {
+    return UPPER_LEFT(a, axis) <= LOWER_RIGHT(b, axis) + 1 && UPPER_LEFT(b, axis) <= LOWER_RIGHT(a, axis) + 1;
+}
+
+static bool regions_can_merge(const DirtyRegion *const a, const DirtyRegion *const b) {
+    return axis_overlaps_or_touches(a, b, 0) && axis_overlaps_or_touches(a, b, 1);
+}
+
+static void merge_into(DirtyRegion *const target, const DirtyRegion *const source) {
+    for (uint8_t axis = 0; axis < 2; axis++) {
+        if (UPPER_LEFT(source, axis) < UPPER_LEFT(target, axis)) UPPER_LEFT(target, axis) = UPPER_LEFT(source, axis);
+        if (LOWER_RIGHT(source, axis) > LOWER_RIGHT(target, axis)) LOWER_RIGHT(target, axis) = LOWER_RIGHT(source, axis);
+    }
+}
+
+static void remove_region(const uint8_t index) {
+    total_regions--;
+    regions[index] = regions[total_regions];
+}
+
+void dirty_regions_add(const uint8_t x, const uint8_t y, const uint8_t width, const uint8_t height) {
+    if (width == 0 || height == 0) return;
+
+    DirtyRegion added = {
+        .upper_left_coordinates  = { x, y },
+        .lower_right_coordinates = { x + width - 1, y + height - 1 }
+    };
+
+    // merging can make the grown region touch others, so keep going until nothing merges
+    uint8_t i = 0;
+    while (i < total_regions) {
+        if (!regions_can_merge(&regions[i], &added)) {
+            i++;
+            continue;
+        }
+
+        merge_into(&added, &regions[i]);
+        remove_region(i);
+        i = 0;
+    }
+
+    if (total_regions == MAX_DIRTY_REGIONS) {
+        merge_into(&regions[0], &added);
+        return;
+    }
+
+    regions[total_regions++] = added;
+}
+
+bool dirty_regions_empty(void) {
+    return total_regions == 0;
+}
+
+uint8_t dirty_regions_count(void) {
+    return total_regions;
+}
+
+const DirtyRegion *dirty_regions_get(const uint8_t index) {
+    return &regions[index];
+}
+
+void dirty_regions_clear(void) {
+    total_regions = 0;
+}
+
+#undef UPPER_LEFT
+#undef LOWER_RIGHT
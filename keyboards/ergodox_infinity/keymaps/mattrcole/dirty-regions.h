@@ -0,0 +1,29 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// Most regions that can be tracked at once. Each element touches at most one
+// blit and one erase area per frame, so this is plenty for 4 elements.
+#define MAX_DIRTY_REGIONS 8
+
+/**
+ * DirtyRegion
+ *
+ * zero-based, inclusive coordinates of a rectangle on the LCD that
+ * has been drawn to since the last flush
+*/
+typedef struct {
+    uint8_t upper_left_coordinates[2], lower_right_coordinates[2];
+} DirtyRegion;
+
+// Marks the given area (given as delta x, delta y) as changed. Regions that
+// overlap or touch an already tracked region are merged into it.
+void dirty_regions_add(const uint8_t x, const uint8_t y, const uint8_t width, const uint8_t height);
+
+bool dirty_regions_empty(void);
+
+uint8_t dirty_regions_count(void);
+
+const DirtyRegion *dirty_regions_get(const uint8_t index);
+
+void dirty_regions_clear(void);
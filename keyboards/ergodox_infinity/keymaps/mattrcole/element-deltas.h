@@ -0,0 +1,1663 @@
+/**
+ * Generated by generate-resources.py from the images in
+ * quantum/visualizer/resources/images and the elements in
+ * animation-keyframes.c, don't edit this file. Run
+ *      make <keyboard>:<keymap>:visualizer-resources
+ * after changing either of them.
+*/
+
+#pragma once
+
+#define ELEMENT_DELTAS_TOTAL_FRAMES 15
+
+// see ELEMENT_DELTAS_CHECKSUM in animation-keyframes.c
+#define ELEMENT_DELTAS_CHECKSUM_LOGO 0x000148a3u
+#define ELEMENT_DELTAS_CHECKSUM_NAME 0x1127f5abu
+#define ELEMENT_DELTAS_CHECKSUM_LAYER_SYMBOL 0x337675a4u
+#define ELEMENT_DELTAS_CHECKSUM_MODE 0x1138b82cu
+
+// LOGO showing resource_logo_win
+static const uint8_t element_deltas_logo_logo_win_runs[1924] = {
+    0x20, 0x04, 0x40, 0x02, 0x80, 0x04, 0x0c, 0x04,
+    0x40, 0x02, 0x80, 0x04, 0x0c, 0x04, 0x40, 0x02,
+    0x80, 0x04, 0x0c, 0x04, 0x40, 0x02, 0x80, 0x04,
+    0x0c, 0x04, 0x40, 0x02, 0x80, 0x04, 0x0c, 0x04,
+    0x40, 0x02, 0x80, 0x04, 0x0c, 0x04, 0x40, 0x02,
+    0x80, 0x04, 0x0c, 0x04, 0x40, 0x02, 0x80, 0x04,
+    0x0c, 0x04, 0x40, 0x02, 0x80, 0x04, 0x0c, 0x04,
+    0x40, 0x02, 0x80, 0x04, 0x0c, 0x04, 0x40, 0x02,
+    0x80, 0x04, 0x0c, 0x04, 0x40, 0x02, 0x80, 0x04,
+    0x0c, 0x04, 0x40, 0x02, 0x80, 0x04, 0x2c, 0x04,
+    0x40, 0x02, 0x80, 0x04, 0x0c, 0x04, 0x40, 0x02,
+    0x80, 0x04, 0x0c, 0x04, 0x40, 0x02, 0x80, 0x04,
+    0x0c, 0x04, 0x40, 0x02, 0x80, 0x04, 0x0c, 0x04,
+    0x40, 0x02, 0x80, 0x04, 0x0c, 0x04, 0x40, 0x02,
+    0x80, 0x04, 0x0c, 0x04, 0x40, 0x02, 0x80, 0x04,
+    0x0c, 0x04, 0x40, 0x02, 0x80, 0x04, 0x0c, 0x04,
+    0x40, 0x02, 0x80, 0x04, 0x0c, 0x04, 0x40, 0x02,
+    0x80, 0x04, 0x0c, 0x04, 0x40, 0x02, 0x80, 0x04,
+    0x0c, 0x04, 0x40, 0x02, 0x80, 0x04, 0x0c, 0x04,
+    0x40, 0x02, 0x80, 0x04, 0x20, 0x02, 0x80, 0x05,
+    0x01, 0x01, 0x08, 0x0c, 0x02, 0x80, 0x05, 0x01,
+    0x01, 0x08, 0x0c, 0x02, 0x80, 0x05, 0x01, 0x01,
+    0x08, 0x0c, 0x02, 0x80, 0x05, 0x01, 0x01, 0x08,
+    0x0c, 0x02, 0x80, 0x05, 0x01, 0x01, 0x08, 0x0c,
+    0x02, 0x80, 0x05, 0x01, 0x01, 0x08, 0x0c, 0x02,
+    0x80, 0x05, 0x01, 0x01, 0x08, 0x0c, 0x02, 0x80,
+    0x05, 0x01, 0x01, 0x08, 0x0c, 0x02, 0x80, 0x05,
+    0x01, 0x01, 0x08, 0x0c, 0x02, 0x80, 0x05, 0x01,
+    0x01, 0x08, 0x0c, 0x02, 0x80, 0x05, 0x01, 0x01,
+    0x08, 0x0c, 0x02, 0x80, 0x05, 0x01, 0x01, 0x08,
+    0x0c, 0x02, 0x80, 0x05, 0x01, 0x01, 0x08, 0x2c,
+    0x02, 0x80, 0x05, 0x01, 0x01, 0x08, 0x0c, 0x02,
+    0x80, 0x05, 0x01, 0x01, 0x08, 0x0c, 0x02, 0x80,
+    0x05, 0x01, 0x01, 0x08, 0x0c, 0x02, 0x80, 0x05,
+    0x01, 0x01, 0x08, 0x0c, 0x02, 0x80, 0x05, 0x01,
+    0x01, 0x08, 0x0c, 0x02, 0x80, 0x05, 0x01, 0x01,
+    0x08, 0x0c, 0x02, 0x80, 0x05, 0x01, 0x01, 0x08,
+    0x0c, 0x02, 0x80, 0x05, 0x01, 0x01, 0x08, 0x0c,
+    0x02, 0x80, 0x05, 0x01, 0x01, 0x08, 0x0c, 0x02,
+    0x80, 0x05, 0x01, 0x01, 0x08, 0x0c, 0x02, 0x80,
+    0x05, 0x01, 0x01, 0x08, 0x0c, 0x02, 0x80, 0x05,
+    0x01, 0x01, 0x08, 0x0c, 0x02, 0x80, 0x05, 0x01,
+    0x01, 0x08, 0x21, 0x01, 0x0a, 0x01, 0x01, 0x10,
+    0x0d, 0x01, 0x0a, 0x01, 0x01, 0x10, 0x0d, 0x01,
+    0x0a, 0x01, 0x01, 0x10, 0x0d, 0x01, 0x0a, 0x01,
+    0x01, 0x10, 0x0d, 0x01, 0x0a, 0x01, 0x01, 0x10,
+    0x0d, 0x01, 0x0a, 0x01, 0x01, 0x10, 0x0d, 0x01,
+    0x0a, 0x01, 0x01, 0x10, 0x0d, 0x01, 0x0a, 0x01,
+    0x01, 0x10, 0x0d, 0x01, 0x0a, 0x01, 0x01, 0x10,
+    0x0d, 0x01, 0x0a, 0x01, 0x01, 0x10, 0x0d, 0x01,
+    0x0a, 0x01, 0x01, 0x10, 0x0d, 0x01, 0x0a, 0x01,
+    0x01, 0x10, 0x0d, 0x01, 0x0a, 0x01, 0x01, 0x10,
+    0x2d, 0x01, 0x0a, 0x01, 0x01, 0x10, 0x0d, 0x01,
+    0x0a, 0x01, 0x01, 0x10, 0x0d, 0x01, 0x0a, 0x01,
+    0x01, 0x10, 0x0d, 0x01, 0x0a, 0x01, 0x01, 0x10,
+    0x0d, 0x01, 0x0a, 0x01, 0x01, 0x10, 0x0d, 0x01,
+    0x0a, 0x01, 0x01, 0x10, 0x0d, 0x01, 0x0a, 0x01,
+    0x01, 0x10, 0x0d, 0x01, 0x0a, 0x01, 0x01, 0x10,
+    0x0d, 0x01, 0x0a, 0x01, 0x01, 0x10, 0x0d, 0x01,
+    0x0a, 0x01, 0x01, 0x10, 0x0d, 0x01, 0x0a, 0x01,
+    0x01, 0x10, 0x0d, 0x01, 0x0a, 0x01, 0x01, 0x10,
+    0x0d, 0x01, 0x0a, 0x01, 0x01, 0x10, 0x21, 0x01,
+    0x14, 0x01, 0x01, 0x20, 0x0d, 0x01, 0x14, 0x01,
+    0x01, 0x20, 0x0d, 0x01, 0x14, 0x01, 0x01, 0x20,
+    0x0d, 0x01, 0x14, 0x01, 0x01, 0x20, 0x0d, 0x01,
+    0x14, 0x01, 0x01, 0x20, 0x0d, 0x01, 0x14, 0x01,
+    0x01, 0x20, 0x0d, 0x01, 0x14, 0x01, 0x01, 0x20,
+    0x0d, 0x01, 0x14, 0x01, 0x01, 0x20, 0x0d, 0x01,
+    0x14, 0x01, 0x01, 0x20, 0x0d, 0x01, 0x14, 0x01,
+    0x01, 0x20, 0x0d, 0x01, 0x14, 0x01, 0x01, 0x20,
+    0x0d, 0x01, 0x14, 0x01, 0x01, 0x20, 0x0d, 0x01,
+    0x14, 0x01, 0x01, 0x20, 0x2d, 0x01, 0x14, 0x01,
+    0x01, 0x20, 0x0d, 0x01, 0x14, 0x01, 0x01, 0x20,
+    0x0d, 0x01, 0x14, 0x01, 0x01, 0x20, 0x0d, 0x01,
+    0x14, 0x01, 0x01, 0x20, 0x0d, 0x01, 0x14, 0x01,
+    0x01, 0x20, 0x0d, 0x01, 0x14, 0x01, 0x01, 0x20,
+    0x0d, 0x01, 0x14, 0x01, 0x01, 0x20, 0x0d, 0x01,
+    0x14, 0x01, 0x01, 0x20, 0x0d, 0x01, 0x14, 0x01,
+    0x01, 0x20, 0x0d, 0x01, 0x14, 0x01, 0x01, 0x20,
+    0x0d, 0x01, 0x14, 0x01, 0x01, 0x20, 0x0d, 0x01,
+    0x14, 0x01, 0x01, 0x20, 0x0d, 0x01, 0x14, 0x01,
+    0x01, 0x20, 0x21, 0x01, 0x28, 0x01, 0x01, 0x40,
+    0x0d, 0x01, 0x28, 0x01, 0x01, 0x40, 0x0d, 0x01,
+    0x28, 0x01, 0x01, 0x40, 0x0d, 0x01, 0x28, 0x01,
+    0x01, 0x40, 0x0d, 0x01, 0x28, 0x01, 0x01, 0x40,
+    0x0d, 0x01, 0x28, 0x01, 0x01, 0x40, 0x0d, 0x01,
+    0x28, 0x01, 0x01, 0x40, 0x0d, 0x01, 0x28, 0x01,
+    0x01, 0x40, 0x0d, 0x01, 0x28, 0x01, 0x01, 0x40,
+    0x0d, 0x01, 0x28, 0x01, 0x01, 0x40, 0x0d, 0x01,
+    0x28, 0x01, 0x01, 0x40, 0x0d, 0x01, 0x28, 0x01,
+    0x01, 0x40, 0x0d, 0x01, 0x28, 0x01, 0x01, 0x40,
+    0x2d, 0x01, 0x28, 0x01, 0x01, 0x40, 0x0d, 0x01,
+    0x28, 0x01, 0x01, 0x40, 0x0d, 0x01, 0x28, 0x01,
+    0x01, 0x40, 0x0d, 0x01, 0x28, 0x01, 0x01, 0x40,
+    0x0d, 0x01, 0x28, 0x01, 0x01, 0x40, 0x0d, 0x01,
+    0x28, 0x01, 0x01, 0x40, 0x0d, 0x01, 0x28, 0x01,
+    0x01, 0x40, 0x0d, 0x01, 0x28, 0x01, 0x01, 0x40,
+    0x0d, 0x01, 0x28, 0x01, 0x01, 0x40, 0x0d, 0x01,
+    0x28, 0x01, 0x01, 0x40, 0x0d, 0x01, 0x28, 0x01,
+    0x01, 0x40, 0x0d, 0x01, 0x28, 0x01, 0x01, 0x40,
+    0x0d, 0x01, 0x28, 0x01, 0x01, 0x40, 0x21, 0x01,
+    0x50, 0x01, 0x01, 0x80, 0x0d, 0x01, 0x50, 0x01,
+    0x01, 0x80, 0x0d, 0x01, 0x50, 0x01, 0x01, 0x80,
+    0x0d, 0x01, 0x50, 0x01, 0x01, 0x80, 0x0d, 0x01,
+    0x50, 0x01, 0x01, 0x80, 0x0d, 0x01, 0x50, 0x01,
+    0x01, 0x80, 0x0d, 0x01, 0x50, 0x01, 0x01, 0x80,
+    0x0d, 0x01, 0x50, 0x01, 0x01, 0x80, 0x0d, 0x01,
+    0x50, 0x01, 0x01, 0x80, 0x0d, 0x01, 0x50, 0x01,
+    0x01, 0x80, 0x0d, 0x01, 0x50, 0x01, 0x01, 0x80,
+    0x0d, 0x01, 0x50, 0x01, 0x01, 0x80, 0x0d, 0x01,
+    0x50, 0x01, 0x01, 0x80, 0x2d, 0x01, 0x50, 0x01,
+    0x01, 0x80, 0x0d, 0x01, 0x50, 0x01, 0x01, 0x80,
+    0x0d, 0x01, 0x50, 0x01, 0x01, 0x80, 0x0d, 0x01,
+    0x50, 0x01, 0x01, 0x80, 0x0d, 0x01, 0x50, 0x01,
+    0x01, 0x80, 0x0d, 0x01, 0x50, 0x01, 0x01, 0x80,
+    0x0d, 0x01, 0x50, 0x01, 0x01, 0x80, 0x0d, 0x01,
+    0x50, 0x01, 0x01, 0x80, 0x0d, 0x01, 0x50, 0x01,
+    0x01, 0x80, 0x0d, 0x01, 0x50, 0x01, 0x01, 0x80,
+    0x0d, 0x01, 0x50, 0x01, 0x01, 0x80, 0x0d, 0x01,
+    0x50, 0x01, 0x01, 0x80, 0x0d, 0x01, 0x50, 0x01,
+    0x01, 0x80, 0x21, 0x02, 0xa0, 0x01, 0x0e, 0x02,
+    0xa0, 0x01, 0x0e, 0x02, 0xa0, 0x01, 0x0e, 0x02,
+    0xa0, 0x01, 0x0e, 0x02, 0xa0, 0x01, 0x0e, 0x02,
+    0xa0, 0x01, 0x0e, 0x02, 0xa0, 0x01, 0x0e, 0x02,
+    0xa0, 0x01, 0x0e, 0x02, 0xa0, 0x01, 0x0e, 0x02,
+    0xa0, 0x01, 0x0e, 0x02, 0xa0, 0x01, 0x0e, 0x02,
+    0xa0, 0x01, 0x0e, 0x02, 0xa0, 0x01, 0x2e, 0x02,
+    0xa0, 0x01, 0x0e, 0x02, 0xa0, 0x01, 0x0e, 0x02,
+    0xa0, 0x01, 0x0e, 0x02, 0xa0, 0x01, 0x0e, 0x02,
+    0xa0, 0x01, 0x0e, 0x02, 0xa0, 0x01, 0x0e, 0x02,
+    0xa0, 0x01, 0x0e, 0x02, 0xa0, 0x01, 0x0e, 0x02,
+    0xa0, 0x01, 0x0e, 0x02, 0xa0, 0x01, 0x0e, 0x02,
+    0xa0, 0x01, 0x0e, 0x02, 0xa0, 0x01, 0x0e, 0x02,
+    0xa0, 0x01, 0x20, 0x03, 0x03, 0xc0, 0x06, 0x0d,
+    0x03, 0x03, 0xc0, 0x06, 0x0d, 0x03, 0x03, 0xc0,
+    0x06, 0x0d, 0x03, 0x03, 0xc0, 0x06, 0x0d, 0x03,
+    0x03, 0xc0, 0x06, 0x0d, 0x03, 0x03, 0xc0, 0x06,
+    0x0d, 0x03, 0x03, 0xc0, 0x06, 0x0d, 0x03, 0x03,
+    0xc0, 0x06, 0x0d, 0x03, 0x03, 0xc0, 0x06, 0x0d,
+    0x03, 0x03, 0xc0, 0x06, 0x0d, 0x03, 0x03, 0xc0,
+    0x06, 0x0d, 0x03, 0x03, 0xc0, 0x06, 0x0d, 0x03,
+    0x03, 0xc0, 0x06, 0x2d, 0x03, 0x03, 0xc0, 0x06,
+    0x0d, 0x03, 0x03, 0xc0, 0x06, 0x0d, 0x03, 0x03,
+    0xc0, 0x06, 0x0d, 0x03, 0x03, 0xc0, 0x06, 0x0d,
+    0x03, 0x03, 0xc0, 0x06, 0x0d, 0x03, 0x03, 0xc0,
+    0x06, 0x0d, 0x03, 0x03, 0xc0, 0x06, 0x0d, 0x03,
+    0x03, 0xc0, 0x06, 0x0d, 0x03, 0x03, 0xc0, 0x06,
+    0x0d, 0x03, 0x03, 0xc0, 0x06, 0x0d, 0x03, 0x03,
+    0xc0, 0x06, 0x0d, 0x03, 0x03, 0xc0, 0x06, 0x0d,
+    0x03, 0x03, 0xc0, 0x06, 0x20, 0x01, 0x0f, 0x01,
+    0x01, 0x18, 0x0d, 0x01, 0x0f, 0x01, 0x01, 0x18,
+    0x0d, 0x01, 0x0f, 0x01, 0x01, 0x18, 0x0d, 0x01,
+    0x0f, 0x01, 0x01, 0x18, 0x0d, 0x01, 0x0f, 0x01,
+    0x01, 0x18, 0x0d, 0x01, 0x0f, 0x01, 0x01, 0x18,
+    0x0d, 0x01, 0x0f, 0x01, 0x01, 0x18, 0x0d, 0x01,
+    0x0f, 0x01, 0x01, 0x18, 0x0d, 0x01, 0x0f, 0x01,
+    0x01, 0x18, 0x0d, 0x01, 0x0f, 0x01, 0x01, 0x18,
+    0x0d, 0x01, 0x0f, 0x01, 0x01, 0x18, 0x0d, 0x01,
+    0x0f, 0x01, 0x01, 0x18, 0x0d, 0x01, 0x0f, 0x01,
+    0x01, 0x18, 0x2d, 0x01, 0x0f, 0x01, 0x01, 0x18,
+    0x0d, 0x01, 0x0f, 0x01, 0x01, 0x18, 0x0d, 0x01,
+    0x0f, 0x01, 0x01, 0x18, 0x0d, 0x01, 0x0f, 0x01,
+    0x01, 0x18, 0x0d, 0x01, 0x0f, 0x01, 0x01, 0x18,
+    0x0d, 0x01, 0x0f, 0x01, 0x01, 0x18, 0x0d, 0x01,
+    0x0f, 0x01, 0x01, 0x18, 0x0d, 0x01, 0x0f, 0x01,
+    0x01, 0x18, 0x0d, 0x01, 0x0f, 0x01, 0x01, 0x18,
+    0x0d, 0x01, 0x0f, 0x01, 0x01, 0x18, 0x0d, 0x01,
+    0x0f, 0x01, 0x01, 0x18, 0x0d, 0x01, 0x0f, 0x01,
+    0x01, 0x18, 0x0d, 0x01, 0x0f, 0x01, 0x01, 0x18,
+    0x20, 0x01, 0x3c, 0x01, 0x01, 0x60, 0x0d, 0x01,
+    0x3c, 0x01, 0x01, 0x60, 0x0d, 0x01, 0x3c, 0x01,
+    0x01, 0x60, 0x0d, 0x01, 0x3c, 0x01, 0x01, 0x60,
+    0x0d, 0x01, 0x3c, 0x01, 0x01, 0x60, 0x0d, 0x01,
+    0x3c, 0x01, 0x01, 0x60, 0x0d, 0x01, 0x3c, 0x01,
+    0x01, 0x60, 0x0d, 0x01, 0x3c, 0x01, 0x01, 0x60,
+    0x0d, 0x01, 0x3c, 0x01, 0x01, 0x60, 0x0d, 0x01,
+    0x3c, 0x01, 0x01, 0x60, 0x0d, 0x01, 0x3c, 0x01,
+    0x01, 0x60, 0x0d, 0x01, 0x3c, 0x01, 0x01, 0x60,
+    0x0d, 0x01, 0x3c, 0x01, 0x01, 0x60, 0x2d, 0x01,
+    0x3c, 0x01, 0x01, 0x60, 0x0d, 0x01, 0x3c, 0x01,
+    0x01, 0x60, 0x0d, 0x01, 0x3c, 0x01, 0x01, 0x60,
+    0x0d, 0x01, 0x3c, 0x01, 0x01, 0x60, 0x0d, 0x01,
+    0x3c, 0x01, 0x01, 0x60, 0x0d, 0x01, 0x3c, 0x01,
+    0x01, 0x60, 0x0d, 0x01, 0x3c, 0x01, 0x01, 0x60,
+    0x0d, 0x01, 0x3c, 0x01, 0x01, 0x60, 0x0d, 0x01,
+    0x3c, 0x01, 0x01, 0x60, 0x0d, 0x01, 0x3c, 0x01,
+    0x01, 0x60, 0x0d, 0x01, 0x3c, 0x01, 0x01, 0x60,
+    0x0d, 0x01, 0x3c, 0x01, 0x01, 0x60, 0x0d, 0x01,
+    0x3c, 0x01, 0x01, 0x60, 0x20, 0x03, 0xf0, 0x01,
+    0x80, 0x0d, 0x03, 0xf0, 0x01, 0x80, 0x0d, 0x03,
+    0xf0, 0x01, 0x80, 0x0d, 0x03, 0xf0, 0x01, 0x80,
+    0x0d, 0x03, 0xf0, 0x01, 0x80, 0x0d, 0x03, 0xf0,
+    0x01, 0x80, 0x0d, 0x03, 0xf0, 0x01, 0x80, 0x0d,
+    0x03, 0xf0, 0x01, 0x80, 0x0d, 0x03, 0xf0, 0x01,
+    0x80, 0x0d, 0x03, 0xf0, 0x01, 0x80, 0x0d, 0x03,
+    0xf0, 0x01, 0x80, 0x0d, 0x03, 0xf0, 0x01, 0x80,
+    0x0d, 0x03, 0xf0, 0x01, 0x80, 0x2d, 0x03, 0xf0,
+    0x01, 0x80, 0x0d, 0x03, 0xf0, 0x01, 0x80, 0x0d,
+    0x03, 0xf0, 0x01, 0x80, 0x0d, 0x03, 0xf0, 0x01,
+    0x80, 0x0d, 0x03, 0xf0, 0x01, 0x80, 0x0d, 0x03,
+    0xf0, 0x01, 0x80, 0x0d, 0x03, 0xf0, 0x01, 0x80,
+    0x0d, 0x03, 0xf0, 0x01, 0x80, 0x0d, 0x03, 0xf0,
+    0x01, 0x80, 0x0d, 0x03, 0xf0, 0x01, 0x80, 0x0d,
+    0x03, 0xf0, 0x01, 0x80, 0x0d, 0x03, 0xf0, 0x01,
+    0x80, 0x0d, 0x03, 0xf0, 0x01, 0x80, 0x20, 0x02,
+    0xc0, 0x0e, 0x0e, 0x02, 0xc0, 0x0e, 0x0e, 0x02,
+    0xc0, 0x0e, 0x0e, 0x02, 0xc0, 0x0e, 0x0e, 0x02,
+    0xc0, 0x0e, 0x0e, 0x02, 0xc0, 0x0e, 0x0e, 0x02,
+    0xc0, 0x0e, 0x0e, 0x02, 0xc0, 0x0e, 0x0e, 0x02,
+    0xc0, 0x0e, 0x0e, 0x02, 0xc0, 0x0e, 0x0e, 0x02,
+    0xc0, 0x0e, 0x0e, 0x02, 0xc0, 0x0e, 0x0e, 0x02,
+    0xc0, 0x0e, 0x2e, 0x02, 0xc0, 0x0e, 0x0e, 0x02,
+    0xc0, 0x0e, 0x0e, 0x02, 0xc0, 0x0e, 0x0e, 0x02,
+    0xc0, 0x0e, 0x0e, 0x02, 0xc0, 0x0e, 0x0e, 0x02,
+    0xc0, 0x0e, 0x0e, 0x02, 0xc0, 0x0e, 0x0e, 0x02,
+    0xc0, 0x0e, 0x0e, 0x02, 0xc0, 0x0e, 0x0e, 0x02,
+    0xc0, 0x0e, 0x0e, 0x02, 0xc0, 0x0e, 0x0e, 0x02,
+    0xc0, 0x0e, 0x0e, 0x02, 0xc0, 0x0e, 0x20, 0x02,
+    0x01, 0xf0, 0x0e, 0x02, 0x01, 0xf0, 0x0e, 0x02,
+    0x01, 0xf0, 0x0e, 0x02, 0x01, 0xf0, 0x0e, 0x02,
+    0x01, 0xf0, 0x0e, 0x02, 0x01, 0xf0, 0x0e, 0x02,
+    0x01, 0xf0, 0x0e, 0x02, 0x01, 0xf0, 0x0e, 0x02,
+    0x01, 0xf0, 0x0e, 0x02, 0x01, 0xf0, 0x0e, 0x02,
+    0x01, 0xf0, 0x0e, 0x02, 0x01, 0xf0, 0x0e, 0x02,
+    0x01, 0xf0, 0x2e, 0x02, 0x01, 0xf0, 0x0e, 0x02,
+    0x01, 0xf0, 0x0e, 0x02, 0x01, 0xf0, 0x0e, 0x02,
+    0x01, 0xf0, 0x0e, 0x02, 0x01, 0xf0, 0x0e, 0x02,
+    0x01, 0xf0, 0x0e, 0x02, 0x01, 0xf0, 0x0e, 0x02,
+    0x01, 0xf0, 0x0e, 0x02, 0x01, 0xf0, 0x0e, 0x02,
+    0x01, 0xf0, 0x0e, 0x02, 0x01, 0xf0, 0x0e, 0x02,
+    0x01, 0xf0, 0x0e, 0x02, 0x01, 0xf0, 0x20, 0x01,
+    0xfe, 0x0f, 0x01, 0xfe, 0x0f, 0x01, 0xfe, 0x0f,
+    0x01, 0xfe, 0x0f, 0x01, 0xfe, 0x0f, 0x01, 0xfe,
+    0x0f, 0x01, 0xfe, 0x0f, 0x01, 0xfe, 0x0f, 0x01,
+    0xfe, 0x0f, 0x01, 0xfe, 0x0f, 0x01, 0xfe, 0x0f,
+    0x01, 0xfe, 0x0f, 0x01, 0xfe, 0x2f, 0x01, 0xfe,
+    0x0f, 0x01, 0xfe, 0x0f, 0x01, 0xfe, 0x0f, 0x01,
+    0xfe, 0x0f, 0x01, 0xfe, 0x0f, 0x01, 0xfe, 0x0f,
+    0x01, 0xfe, 0x0f, 0x01, 0xfe, 0x0f, 0x01, 0xfe,
+    0x0f, 0x01, 0xfe, 0x0f, 0x01, 0xfe, 0x0f, 0x01,
+    0xfe, 0x0f, 0x01, 0xfe
+};
+
+static const ElementDeltas element_deltas_logo_logo_win = {
+    .resource = &resource_logo_win,
+    .steps = {
+        { {   0,  2,  32, 28 },  156, element_deltas_logo_logo_win_runs + 0 },
+        { {   0,  0,   0,  0 },    0, element_deltas_logo_logo_win_runs + 156 },
+        { {   0,  2,  32, 28 },  182, element_deltas_logo_logo_win_runs + 156 },
+        { {   8,  2,  24, 28 },  156, element_deltas_logo_logo_win_runs + 338 },
+        { {   8,  2,  24, 28 },  156, element_deltas_logo_logo_win_runs + 494 },
+        { {   8,  2,  24, 28 },  156, element_deltas_logo_logo_win_runs + 650 },
+        { {   8,  2,  24, 28 },  156, element_deltas_logo_logo_win_runs + 806 },
+        { {   8,  2,  16, 28 },  104, element_deltas_logo_logo_win_runs + 962 },
+        { {   0,  2,  24, 28 },  130, element_deltas_logo_logo_win_runs + 1066 },
+        { {   0,  2,  24, 28 },  156, element_deltas_logo_logo_win_runs + 1196 },
+        { {   0,  2,  24, 28 },  156, element_deltas_logo_logo_win_runs + 1352 },
+        { {   0,  2,  24, 28 },  130, element_deltas_logo_logo_win_runs + 1508 },
+        { {   0,  2,  16, 28 },  104, element_deltas_logo_logo_win_runs + 1638 },
+        { {   0,  2,  16, 28 },  104, element_deltas_logo_logo_win_runs + 1742 },
+        { {   0,  2,   8, 28 },   78, element_deltas_logo_logo_win_runs + 1846 }
+    },
+    .appear = { {   0,  0,   0,  0 },    0, element_deltas_logo_logo_win_runs + 1924 }
+};
+
+// NAME showing resource_name_win
+static const uint8_t element_deltas_name_name_win_runs[761] = {
+    0x24, 0x02, 0xd9, 0x18, 0x01, 0x01, 0x02, 0x0d,
+    0x01, 0x18, 0x0e, 0x07, 0x02, 0x78, 0x6c, 0x38,
+    0x3c, 0xd9, 0x3c, 0x09, 0x05, 0x80, 0x40, 0x12,
+    0x44, 0x42, 0x01, 0x01, 0x42, 0x09, 0x07, 0x08,
+    0x30, 0x18, 0x18, 0x1c, 0x82, 0x1e, 0x09, 0x01,
+    0x04, 0x01, 0x02, 0x04, 0x04, 0x02, 0x01, 0x58,
+    0x09, 0x01, 0x21, 0x04, 0x02, 0x0d, 0x26, 0x0c,
+    0x01, 0x04, 0x01, 0x02, 0x20, 0x1c, 0x09, 0x02,
+    0x10, 0x76, 0x01, 0x04, 0x18, 0x1c, 0x10, 0x74,
+    0x0a, 0x01, 0x01, 0x01, 0x02, 0x44, 0x42, 0x01,
+    0x01, 0x4a, 0x09, 0x07, 0x66, 0x7f, 0x62, 0x3a,
+    0x3c, 0x66, 0x3c, 0x14, 0x02, 0xd9, 0x18, 0x01,
+    0x01, 0x02, 0x0d, 0x01, 0x18, 0x0e, 0x07, 0x02,
+    0x78, 0x6c, 0x38, 0x3c, 0xd9, 0x3c, 0x09, 0x05,
+    0x80, 0x40, 0x12, 0x44, 0x42, 0x01, 0x01, 0x42,
+    0x09, 0x07, 0x08, 0x30, 0x18, 0x18, 0x1c, 0x82,
+    0x1e, 0x09, 0x01, 0x04, 0x01, 0x02, 0x04, 0x04,
+    0x02, 0x01, 0x58, 0x09, 0x01, 0x21, 0x04, 0x02,
+    0x0d, 0x26, 0x0c, 0x01, 0x04, 0x01, 0x02, 0x20,
+    0x1c, 0x09, 0x02, 0x10, 0x76, 0x01, 0x04, 0x18,
+    0x1c, 0x10, 0x74, 0x0a, 0x01, 0x01, 0x01, 0x02,
+    0x44, 0x42, 0x01, 0x01, 0x4a, 0x09, 0x07, 0x66,
+    0x7f, 0x62, 0x3a, 0x3c, 0x66, 0x3c, 0x04, 0x02,
+    0xd9, 0x18, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x18,
+    0x0e, 0x07, 0x02, 0x78, 0x6c, 0x38, 0x3c, 0xd9,
+    0x3c, 0x09, 0x05, 0x80, 0x40, 0x12, 0x44, 0x42,
+    0x01, 0x01, 0x42, 0x09, 0x07, 0x08, 0x30, 0x18,
+    0x18, 0x1c, 0x82, 0x1e, 0x09, 0x01, 0x04, 0x01,
+    0x02, 0x04, 0x04, 0x02, 0x01, 0x58, 0x09, 0x01,
+    0x21, 0x04, 0x02, 0x0d, 0x26, 0x0c, 0x01, 0x04,
+    0x01, 0x02, 0x20, 0x1c, 0x09, 0x02, 0x10, 0x76,
+    0x01, 0x04, 0x18, 0x1c, 0x10, 0x74, 0x0a, 0x01,
+    0x01, 0x01, 0x02, 0x44, 0x42, 0x01, 0x01, 0x4a,
+    0x09, 0x07, 0x66, 0x7f, 0x62, 0x3a, 0x3c, 0x66,
+    0x3c, 0x05, 0x01, 0x18, 0x0e, 0x07, 0x02, 0x78,
+    0x6c, 0x38, 0x3c, 0xd9, 0x3c, 0x09, 0x05, 0x80,
+    0x40, 0x12, 0x44, 0x42, 0x01, 0x01, 0x42, 0x09,
+    0x07, 0x08, 0x30, 0x18, 0x18, 0x1c, 0x82, 0x1e,
+    0x09, 0x01, 0x04, 0x01, 0x02, 0x04, 0x04, 0x02,
+    0x01, 0x58, 0x09, 0x01, 0x21, 0x04, 0x02, 0x0d,
+    0x26, 0x0c, 0x01, 0x04, 0x01, 0x02, 0x20, 0x1c,
+    0x09, 0x02, 0x10, 0x76, 0x01, 0x04, 0x18, 0x1c,
+    0x10, 0x74, 0x0a, 0x01, 0x01, 0x01, 0x02, 0x44,
+    0x42, 0x01, 0x01, 0x4a, 0x09, 0x07, 0x66, 0x7f,
+    0x62, 0x3a, 0x3c, 0x66, 0x3c, 0x04, 0x07, 0x02,
+    0x78, 0x6c, 0x38, 0x3c, 0xd9, 0x3c, 0x09, 0x05,
+    0x80, 0x40, 0x12, 0x44, 0x42, 0x01, 0x01, 0x42,
+    0x09, 0x07, 0x08, 0x30, 0x18, 0x18, 0x1c, 0x82,
+    0x1e, 0x09, 0x01, 0x04, 0x01, 0x02, 0x04, 0x04,
+    0x02, 0x01, 0x58, 0x09, 0x01, 0x21, 0x04, 0x02,
+    0x0d, 0x26, 0x0c, 0x01, 0x04, 0x01, 0x02, 0x20,
+    0x1c, 0x09, 0x02, 0x10, 0x76, 0x01, 0x04, 0x18,
+    0x1c, 0x10, 0x74, 0x0a, 0x01, 0x01, 0x01, 0x02,
+    0x44, 0x42, 0x01, 0x01, 0x4a, 0x09, 0x07, 0x66,
+    0x7f, 0x62, 0x3a, 0x3c, 0x66, 0x3c, 0x04, 0x05,
+    0x80, 0x40, 0x12, 0x44, 0x42, 0x01, 0x01, 0x42,
+    0x09, 0x07, 0x08, 0x30, 0x18, 0x18, 0x1c, 0x82,
+    0x1e, 0x09, 0x01, 0x04, 0x01, 0x02, 0x04, 0x04,
+    0x02, 0x01, 0x58, 0x09, 0x01, 0x21, 0x04, 0x02,
+    0x0d, 0x26, 0x0c, 0x01, 0x04, 0x01, 0x02, 0x20,
+    0x1c, 0x09, 0x02, 0x10, 0x76, 0x01, 0x04, 0x18,
+    0x1c, 0x10, 0x74, 0x0a, 0x01, 0x01, 0x01, 0x02,
+    0x44, 0x42, 0x01, 0x01, 0x4a, 0x09, 0x07, 0x66,
+    0x7f, 0x62, 0x3a, 0x3c, 0x66, 0x3c, 0x04, 0x07,
+    0x08, 0x30, 0x18, 0x18, 0x1c, 0x82, 0x1e, 0x09,
+    0x01, 0x04, 0x01, 0x02, 0x04, 0x04, 0x02, 0x01,
+    0x58, 0x09, 0x01, 0x21, 0x04, 0x02, 0x0d, 0x26,
+    0x0c, 0x01, 0x04, 0x01, 0x02, 0x20, 0x1c, 0x09,
+    0x02, 0x10, 0x76, 0x01, 0x04, 0x18, 0x1c, 0x10,
+    0x74, 0x0a, 0x01, 0x01, 0x01, 0x02, 0x44, 0x42,
+    0x01, 0x01, 0x4a, 0x09, 0x07, 0x66, 0x7f, 0x62,
+    0x3a, 0x3c, 0x66, 0x3c, 0x04, 0x01, 0x04, 0x01,
+    0x02, 0x04, 0x04, 0x02, 0x01, 0x58, 0x09, 0x01,
+    0x21, 0x04, 0x02, 0x0d, 0x26, 0x0c, 0x01, 0x04,
+    0x01, 0x02, 0x20, 0x1c, 0x09, 0x02, 0x10, 0x76,
+    0x01, 0x04, 0x18, 0x1c, 0x10, 0x74, 0x0a, 0x01,
+    0x01, 0x01, 0x02, 0x44, 0x42, 0x01, 0x01, 0x4a,
+    0x09, 0x07, 0x66, 0x7f, 0x62, 0x3a, 0x3c, 0x66,
+    0x3c, 0x04, 0x01, 0x21, 0x04, 0x02, 0x0d, 0x26,
+    0x0c, 0x01, 0x04, 0x01, 0x02, 0x20, 0x1c, 0x09,
+    0x02, 0x10, 0x76, 0x01, 0x04, 0x18, 0x1c, 0x10,
+    0x74, 0x0a, 0x01, 0x01, 0x01, 0x02, 0x44, 0x42,
+    0x01, 0x01, 0x4a, 0x09, 0x07, 0x66, 0x7f, 0x62,
+    0x3a, 0x3c, 0x66, 0x3c, 0x07, 0x01, 0x04, 0x01,
+    0x02, 0x20, 0x1c, 0x09, 0x02, 0x10, 0x76, 0x01,
+    0x04, 0x18, 0x1c, 0x10, 0x74, 0x0a, 0x01, 0x01,
+    0x01, 0x02, 0x44, 0x42, 0x01, 0x01, 0x4a, 0x09,
+    0x07, 0x66, 0x7f, 0x62, 0x3a, 0x3c, 0x66, 0x3c,
+    0x04, 0x02, 0x10, 0x76, 0x01, 0x04, 0x18, 0x1c,
+    0x10, 0x74, 0x0a, 0x01, 0x01, 0x01, 0x02, 0x44,
+    0x42, 0x01, 0x01, 0x4a, 0x09, 0x07, 0x66, 0x7f,
+    0x62, 0x3a, 0x3c, 0x66, 0x3c, 0x05, 0x01, 0x01,
+    0x01, 0x02, 0x44, 0x42, 0x01, 0x01, 0x4a, 0x09,
+    0x07, 0x66, 0x7f, 0x62, 0x3a, 0x3c, 0x66, 0x3c,
+    0x04, 0x07, 0x66, 0x7f, 0x62, 0x3a, 0x3c, 0x66,
+    0x3c
+};
+
+static const ElementDeltas element_deltas_name_name_win = {
+    .resource = &resource_name_win,
+    .steps = {
+        { {  32,  2,  56, 11 },   91, element_deltas_name_name_win_runs + 0 },
+        { {  32,  1,  56, 11 },   91, element_deltas_name_name_win_runs + 91 },
+        { {  32,  0,  56, 11 },   91, element_deltas_name_name_win_runs + 182 },
+        { {  32,  0,  56, 10 },   84, element_deltas_name_name_win_runs + 273 },
+        { {  32,  0,  56,  9 },   81, element_deltas_name_name_win_runs + 357 },
+        { {  32,  0,  56,  8 },   72, element_deltas_name_name_win_runs + 438 },
+        { {  32,  0,  56,  7 },   62, element_deltas_name_name_win_runs + 510 },
+        { {  32,  0,  56,  6 },   53, element_deltas_name_name_win_runs + 572 },
+        { {  32,  0,  56,  5 },   43, element_deltas_name_name_win_runs + 625 },
+        { {  32,  0,  56,  4 },   36, element_deltas_name_name_win_runs + 668 },
+        { {  32,  0,  56,  3 },   29, element_deltas_name_name_win_runs + 704 },
+        { {  32,  0,  56,  2 },   19, element_deltas_name_name_win_runs + 733 },
+        { {  32,  0,  56,  1 },    9, element_deltas_name_name_win_runs + 752 },
+        { {   0,  0,   0,  0 },    0, element_deltas_name_name_win_runs + 761 },
+        { {   0,  0,   0,  0 },    0, element_deltas_name_name_win_runs + 761 }
+    },
+    .appear = { {   0,  0,   0,  0 },    0, element_deltas_name_name_win_runs + 761 }
+};
+
+// LAYER_SYMBOL showing resource_symbol_keyboard
+static const uint8_t element_deltas_layer_symbol_symbol_keyboard_runs[1043] = {
+    0x5e, 0x01, 0x44, 0x0f, 0x01, 0xc0, 0x0e, 0x02,
+    0x01, 0x80, 0x0e, 0x02, 0x01, 0x80, 0x0e, 0x02,
+    0x01, 0x80, 0x0f, 0x01, 0xc0, 0x0f, 0x01, 0xc0,
+    0x0d, 0x01, 0x02, 0x02, 0x01, 0x08, 0x0c, 0x01,
+    0x04, 0x02, 0x01, 0x04, 0x0c, 0x04, 0x05, 0x6d,
+    0xb6, 0xd4, 0x0c, 0x04, 0x05, 0x6d, 0xb6, 0xd4,
+    0x0c, 0x01, 0x04, 0x02, 0x01, 0x04, 0x0c, 0x04,
+    0x05, 0x6d, 0xb6, 0xd4, 0x0c, 0x04, 0x05, 0x6d,
+    0xb6, 0xd4, 0x0c, 0x01, 0x04, 0x02, 0x01, 0x04,
+    0x0c, 0x04, 0x05, 0x6d, 0xb6, 0xd4, 0x0c, 0x04,
+    0x05, 0x6d, 0xb6, 0xd4, 0x0c, 0x01, 0x04, 0x02,
+    0x01, 0x04, 0x0c, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x0c, 0x01, 0x02, 0x02, 0x01, 0x08, 0x5e, 0x01,
+    0x22, 0x0f, 0x01, 0x60, 0x0f, 0x01, 0xc0, 0x0f,
+    0x01, 0xc0, 0x0f, 0x01, 0xc0, 0x0f, 0x01, 0x60,
+    0x0f, 0x01, 0x60, 0x0d, 0x01, 0x01, 0x02, 0x01,
+    0x04, 0x0c, 0x01, 0x02, 0x02, 0x01, 0x02, 0x0c,
+    0x04, 0x02, 0xb6, 0xdb, 0x6a, 0x0c, 0x04, 0x02,
+    0xb6, 0xdb, 0x6a, 0x0c, 0x01, 0x02, 0x02, 0x01,
+    0x02, 0x0c, 0x04, 0x02, 0xb6, 0xdb, 0x6a, 0x0c,
+    0x04, 0x02, 0xb6, 0xdb, 0x6a, 0x0c, 0x01, 0x02,
+    0x02, 0x01, 0x02, 0x0c, 0x04, 0x02, 0xb6, 0xdb,
+    0x6a, 0x0c, 0x04, 0x02, 0xb6, 0xdb, 0x6a, 0x0c,
+    0x01, 0x02, 0x02, 0x01, 0x02, 0x0c, 0x04, 0x02,
+    0x02, 0x02, 0x02, 0x0c, 0x01, 0x01, 0x02, 0x01,
+    0x04, 0x5e, 0x01, 0x11, 0x0f, 0x01, 0x30, 0x0f,
+    0x01, 0x60, 0x0f, 0x01, 0x60, 0x0f, 0x01, 0x60,
+    0x0f, 0x01, 0x30, 0x0f, 0x01, 0x30, 0x0e, 0x01,
+    0x80, 0x01, 0x01, 0x02, 0x0c, 0x01, 0x01, 0x02,
+    0x01, 0x01, 0x0c, 0x04, 0x01, 0x5b, 0x6d, 0xb5,
+    0x0c, 0x04, 0x01, 0x5b, 0x6d, 0xb5, 0x0c, 0x01,
+    0x01, 0x02, 0x01, 0x01, 0x0c, 0x04, 0x01, 0x5b,
+    0x6d, 0xb5, 0x0c, 0x04, 0x01, 0x5b, 0x6d, 0xb5,
+    0x0c, 0x01, 0x01, 0x02, 0x01, 0x01, 0x0c, 0x04,
+    0x01, 0x5b, 0x6d, 0xb5, 0x0c, 0x04, 0x01, 0x5b,
+    0x6d, 0xb5, 0x0c, 0x01, 0x01, 0x02, 0x01, 0x01,
+    0x0c, 0x04, 0x01, 0x01, 0x01, 0x01, 0x0d, 0x01,
+    0x80, 0x01, 0x01, 0x02, 0x5e, 0x02, 0x08, 0x80,
+    0x0e, 0x01, 0x18, 0x0f, 0x01, 0x30, 0x0f, 0x01,
+    0x30, 0x0f, 0x01, 0x30, 0x0f, 0x01, 0x18, 0x0f,
+    0x01, 0x18, 0x0e, 0x01, 0x40, 0x01, 0x01, 0x01,
+    0x0d, 0x01, 0x80, 0x0f, 0x03, 0xad, 0xb6, 0xda,
+    0x0d, 0x03, 0xad, 0xb6, 0xda, 0x0d, 0x01, 0x80,
+    0x0f, 0x03, 0xad, 0xb6, 0xda, 0x0d, 0x03, 0xad,
+    0xb6, 0xda, 0x0d, 0x01, 0x80, 0x0f, 0x03, 0xad,
+    0xb6, 0xda, 0x0d, 0x03, 0xad, 0xb6, 0xda, 0x0d,
+    0x01, 0x80, 0x0f, 0x03, 0x80, 0x80, 0x80, 0x0d,
+    0x01, 0x40, 0x01, 0x01, 0x01, 0x5e, 0x02, 0x04,
+    0x40, 0x0e, 0x01, 0x0c, 0x0f, 0x01, 0x18, 0x0f,
+    0x01, 0x18, 0x0f, 0x01, 0x18, 0x0f, 0x01, 0x0c,
+    0x0f, 0x01, 0x0c, 0x0e, 0x01, 0x20, 0x0f, 0x01,
+    0x40, 0x0f, 0x03, 0x56, 0xdb, 0x6d, 0x0d, 0x03,
+    0x56, 0xdb, 0x6d, 0x0d, 0x01, 0x40, 0x0f, 0x03,
+    0x56, 0xdb, 0x6d, 0x0d, 0x03, 0x56, 0xdb, 0x6d,
+    0x0d, 0x01, 0x40, 0x0f, 0x03, 0x56, 0xdb, 0x6d,
+    0x0d, 0x03, 0x56, 0xdb, 0x6d, 0x0d, 0x01, 0x40,
+    0x0f, 0x03, 0x40, 0x40, 0x40, 0x0d, 0x01, 0x20,
+    0x5e, 0x02, 0x02, 0x20, 0x0e, 0x01, 0x06, 0x0f,
+    0x01, 0x0c, 0x0f, 0x01, 0x0c, 0x0f, 0x01, 0x0c,
+    0x0f, 0x01, 0x06, 0x0f, 0x01, 0x06, 0x0e, 0x01,
+    0x10, 0x0f, 0x01, 0x20, 0x0f, 0x03, 0x2b, 0x6d,
+    0xb6, 0x0d, 0x03, 0x2b, 0x6d, 0xb6, 0x0d, 0x01,
+    0x20, 0x0f, 0x03, 0x2b, 0x6d, 0xb6, 0x0d, 0x03,
+    0x2b, 0x6d, 0xb6, 0x0d, 0x01, 0x20, 0x0f, 0x03,
+    0x2b, 0x6d, 0xb6, 0x0d, 0x03, 0x2b, 0x6d, 0xb6,
+    0x0d, 0x01, 0x20, 0x0f, 0x03, 0x20, 0x20, 0x20,
+    0x0d, 0x01, 0x10, 0x5e, 0x02, 0x01, 0x10, 0x0e,
+    0x01, 0x03, 0x0f, 0x01, 0x06, 0x0f, 0x01, 0x06,
+    0x0f, 0x01, 0x06, 0x0f, 0x01, 0x03, 0x0f, 0x01,
+    0x03, 0x0e, 0x01, 0x08, 0x0f, 0x01, 0x10, 0x0f,
+    0x03, 0x15, 0xb6, 0xdb, 0x0d, 0x03, 0x15, 0xb6,
+    0xdb, 0x0d, 0x01, 0x10, 0x0f, 0x03, 0x15, 0xb6,
+    0xdb, 0x0d, 0x03, 0x15, 0xb6, 0xdb, 0x0d, 0x01,
+    0x10, 0x0f, 0x03, 0x15, 0xb6, 0xdb, 0x0d, 0x03,
+    0x15, 0xb6, 0xdb, 0x0d, 0x01, 0x10, 0x0f, 0x03,
+    0x10, 0x10, 0x10, 0x0d, 0x01, 0x08, 0x5f, 0x01,
+    0xcc, 0x0e, 0x02, 0x01, 0x40, 0x0e, 0x02, 0x02,
+    0x80, 0x0e, 0x02, 0x02, 0x80, 0x0e, 0x02, 0x02,
+    0x80, 0x0e, 0x02, 0x01, 0x40, 0x0e, 0x02, 0x01,
+    0x40, 0x0d, 0x01, 0x06, 0x0f, 0x01, 0x0c, 0x0f,
+    0x03, 0x0f, 0xb6, 0xdb, 0x0d, 0x03, 0x0f, 0xb6,
+    0xdb, 0x0d, 0x01, 0x0c, 0x0f, 0x03, 0x0f, 0xb6,
+    0xdb, 0x0d, 0x03, 0x0f, 0xb6, 0xdb, 0x0d, 0x01,
+    0x0c, 0x0f, 0x03, 0x0f, 0xb6, 0xdb, 0x0d, 0x03,
+    0x0f, 0xb6, 0xdb, 0x0d, 0x01, 0x0c, 0x0f, 0x03,
+    0x0c, 0x0c, 0x0c, 0x0d, 0x01, 0x06, 0x5f, 0x01,
+    0x33, 0x0f, 0x01, 0x50, 0x0f, 0x01, 0xa0, 0x0f,
+    0x01, 0xa0, 0x0f, 0x01, 0xa0, 0x0f, 0x01, 0x50,
+    0x0f, 0x01, 0x50, 0x0d, 0x02, 0x01, 0x80, 0x0e,
+    0x01, 0x03, 0x0f, 0x03, 0x03, 0xed, 0xb6, 0x0d,
+    0x03, 0x03, 0xed, 0xb6, 0x0d, 0x01, 0x03, 0x0f,
+    0x03, 0x03, 0xed, 0xb6, 0x0d, 0x03, 0x03, 0xed,
+    0xb6, 0x0d, 0x01, 0x03, 0x0f, 0x03, 0x03, 0xed,
+    0xb6, 0x0d, 0x03, 0x03, 0xed, 0xb6, 0x0d, 0x01,
+    0x03, 0x0f, 0x03, 0x03, 0x03, 0x03, 0x0d, 0x02,
+    0x01, 0x80, 0x5f, 0x01, 0x0c, 0x0f, 0x01, 0x14,
+    0x0f, 0x01, 0x28, 0x0f, 0x01, 0x28, 0x0f, 0x01,
+    0x28, 0x0f, 0x01, 0x14, 0x0f, 0x01, 0x14, 0x0e,
+    0x01, 0x60, 0x0f, 0x01, 0xc0, 0x0f, 0x02, 0xfb,
+    0x6d, 0x0e, 0x02, 0xfb, 0x6d, 0x0e, 0x01, 0xc0,
+    0x0f, 0x02, 0xfb, 0x6d, 0x0e, 0x02, 0xfb, 0x6d,
+    0x0e, 0x01, 0xc0, 0x0f, 0x02, 0xfb, 0x6d, 0x0e,
+    0x02, 0xfb, 0x6d, 0x0e, 0x01, 0xc0, 0x0f, 0x02,
+    0xc0, 0xc0, 0x0e, 0x01, 0x60, 0x5f, 0x01, 0x03,
+    0x0f, 0x01, 0x05, 0x0f, 0x01, 0x0a, 0x0f, 0x01,
+    0x0a, 0x0f, 0x01, 0x0a, 0x0f, 0x01, 0x05, 0x0f,
+    0x01, 0x05, 0x0e, 0x01, 0x18, 0x0f, 0x01, 0x30,
+    0x0f, 0x02, 0x3e, 0xdb, 0x0e, 0x02, 0x3e, 0xdb,
+    0x0e, 0x01, 0x30, 0x0f, 0x02, 0x3e, 0xdb, 0x0e,
+    0x02, 0x3e, 0xdb, 0x0e, 0x01, 0x30, 0x0f, 0x02,
+    0x3e, 0xdb, 0x0e, 0x02, 0x3e, 0xdb, 0x0e, 0x01,
+    0x30, 0x0f, 0x02, 0x30, 0x30, 0x0e, 0x01, 0x18,
+    0x6f, 0x01, 0x01, 0x0f, 0x01, 0x02, 0x0f, 0x01,
+    0x02, 0x0f, 0x01, 0x02, 0x0f, 0x01, 0x01, 0x0f,
+    0x01, 0x01, 0x0e, 0x01, 0x07, 0x0f, 0x01, 0x0e,
+    0x0f, 0x01, 0x0d, 0x0f, 0x01, 0x0d, 0x0f, 0x01,
+    0x0e, 0x0f, 0x01, 0x0d, 0x0f, 0x01, 0x0d, 0x0f,
+    0x01, 0x0e, 0x0f, 0x01, 0x0d, 0x0f, 0x01, 0x0d,
+    0x0f, 0x01, 0x0e, 0x0f, 0x02, 0x0e, 0x0e, 0x0e,
+    0x01, 0x07, 0xcf, 0x01, 0xf8, 0x0e, 0x02, 0x01,
+    0xf0, 0x0e, 0x02, 0x01, 0x9e, 0x0e, 0x02, 0x01,
+    0x9e, 0x0e, 0x02, 0x01, 0xf0, 0x0e, 0x02, 0x01,
+    0x9e, 0x0e, 0x02, 0x01, 0x9e, 0x0e, 0x02, 0x01,
+    0xf0, 0x0e, 0x02, 0x01, 0x9e, 0x0e, 0x02, 0x01,
+    0x9e, 0x0e, 0x02, 0x01, 0xf0, 0x0e, 0x02, 0x01,
+    0xf1, 0x0f, 0x01, 0xf8, 0xcf, 0x01, 0x07, 0x0f,
+    0x01, 0x0f, 0x0f, 0x01, 0x0c, 0x0f, 0x01, 0x0c,
+    0x0f, 0x01, 0x0f, 0x0f, 0x01, 0x0c, 0x0f, 0x01,
+    0x0c, 0x0f, 0x01, 0x0f, 0x0f, 0x01, 0x0c, 0x0f,
+    0x01, 0x0c, 0x0f, 0x01, 0x0f, 0x0f, 0x01, 0x0f,
+    0x0f, 0x01, 0x07
+};
+
+static const ElementDeltas element_deltas_layer_symbol_symbol_keyboard = {
+    .resource = &resource_symbol_keyboard,
+    .steps = {
+        { {  96,  5,  32, 20 },  102, element_deltas_layer_symbol_symbol_keyboard_runs + 0 },
+        { {   0,  0,   0,  0 },    0, element_deltas_layer_symbol_symbol_keyboard_runs + 102 },
+        { {  96,  5,  32, 20 },   99, element_deltas_layer_symbol_symbol_keyboard_runs + 102 },
+        { {  96,  5,  32, 20 },   99, element_deltas_layer_symbol_symbol_keyboard_runs + 201 },
+        { { 104,  5,  24, 20 },   81, element_deltas_layer_symbol_symbol_keyboard_runs + 300 },
+        { { 104,  5,  24, 20 },   75, element_deltas_layer_symbol_symbol_keyboard_runs + 381 },
+        { { 104,  5,  24, 20 },   75, element_deltas_layer_symbol_symbol_keyboard_runs + 456 },
+        { { 104,  5,  24, 20 },   75, element_deltas_layer_symbol_symbol_keyboard_runs + 531 },
+        { { 104,  5,  24, 20 },   80, element_deltas_layer_symbol_symbol_keyboard_runs + 606 },
+        { { 104,  5,  24, 20 },   76, element_deltas_layer_symbol_symbol_keyboard_runs + 686 },
+        { { 112,  5,  16, 20 },   67, element_deltas_layer_symbol_symbol_keyboard_runs + 762 },
+        { { 112,  5,  16, 20 },   67, element_deltas_layer_symbol_symbol_keyboard_runs + 829 },
+        { { 112,  6,  16, 19 },   58, element_deltas_layer_symbol_symbol_keyboard_runs + 896 },
+        { { 112, 12,  16, 13 },   50, element_deltas_layer_symbol_symbol_keyboard_runs + 954 },
+        { { 120, 12,   8, 13 },   39, element_deltas_layer_symbol_symbol_keyboard_runs + 1004 }
+    },
+    .appear = { {   0,  0,   0,  0 },    0, element_deltas_layer_symbol_symbol_keyboard_runs + 1043 }
+};
+
+// MODE showing resource_mode_mode
+static const uint8_t element_deltas_mode_mode_mode_runs[411] = {
+    0xff, 0x00, 0x27, 0x01, 0x04, 0x1d, 0x04, 0xec,
+    0x78, 0x70, 0x78, 0x0c, 0x04, 0x12, 0x84, 0x88,
+    0x84, 0x0c, 0x04, 0x68, 0x38, 0x30, 0x38, 0x0e,
+    0x02, 0x08, 0x38, 0x1e, 0x02, 0x08, 0x3c, 0x0d,
+    0x03, 0x38, 0x30, 0x3c, 0x0d, 0x03, 0x84, 0x88,
+    0x84, 0x0c, 0x04, 0x96, 0x78, 0x74, 0x78, 0xff,
+    0x00, 0x37, 0x01, 0x04, 0x1d, 0x04, 0xec, 0x78,
+    0x70, 0x78, 0x0c, 0x04, 0x12, 0x84, 0x88, 0x84,
+    0x0c, 0x04, 0x68, 0x38, 0x30, 0x38, 0x0e, 0x02,
+    0x08, 0x38, 0x1e, 0x02, 0x08, 0x3c, 0x0d, 0x03,
+    0x38, 0x30, 0x3c, 0x0d, 0x03, 0x84, 0x88, 0x84,
+    0x0c, 0x04, 0x96, 0x78, 0x74, 0x78, 0xff, 0x00,
+    0x47, 0x01, 0x04, 0x1d, 0x04, 0xec, 0x78, 0x70,
+    0x78, 0x0c, 0x04, 0x12, 0x84, 0x88, 0x84, 0x0c,
+    0x04, 0x68, 0x38, 0x30, 0x38, 0x0e, 0x02, 0x08,
+    0x38, 0x1e, 0x02, 0x08, 0x3c, 0x0d, 0x03, 0x38,
+    0x30, 0x3c, 0x0d, 0x03, 0x84, 0x88, 0x84, 0x0c,
+    0x04, 0x96, 0x78, 0x74, 0x78, 0xff, 0x00, 0x57,
+    0x01, 0x04, 0x1d, 0x04, 0xec, 0x78, 0x70, 0x78,
+    0x0c, 0x04, 0x12, 0x84, 0x88, 0x84, 0x0c, 0x04,
+    0x68, 0x38, 0x30, 0x38, 0x0e, 0x02, 0x08, 0x38,
+    0x1e, 0x02, 0x08, 0x3c, 0x0d, 0x03, 0x38, 0x30,
+    0x3c, 0x0d, 0x03, 0x84, 0x88, 0x84, 0x0c, 0x04,
+    0x96, 0x78, 0x74, 0x78, 0xff, 0x00, 0x67, 0x01,
+    0x04, 0x1d, 0x04, 0xec, 0x78, 0x70, 0x78, 0x0c,
+    0x04, 0x12, 0x84, 0x88, 0x84, 0x0c, 0x04, 0x68,
+    0x38, 0x30, 0x38, 0x0e, 0x02, 0x08, 0x38, 0x1e,
+    0x02, 0x08, 0x3c, 0x0d, 0x03, 0x38, 0x30, 0x3c,
+    0x0d, 0x03, 0x84, 0x88, 0x84, 0xff, 0x00, 0x77,
+    0x01, 0x04, 0x1d, 0x04, 0xec, 0x78, 0x70, 0x78,
+    0x0c, 0x04, 0x12, 0x84, 0x88, 0x84, 0x0c, 0x04,
+    0x68, 0x38, 0x30, 0x38, 0x0e, 0x02, 0x08, 0x38,
+    0x1e, 0x02, 0x08, 0x3c, 0x0d, 0x03, 0x38, 0x30,
+    0x3c, 0xff, 0x00, 0x87, 0x01, 0x04, 0x1d, 0x04,
+    0xec, 0x78, 0x70, 0x78, 0x0c, 0x04, 0x12, 0x84,
+    0x88, 0x84, 0x0c, 0x04, 0x68, 0x38, 0x30, 0x38,
+    0x0e, 0x02, 0x08, 0x38, 0x1e, 0x02, 0x08, 0x3c,
+    0xff, 0x00, 0x97, 0x01, 0x04, 0x1d, 0x04, 0xec,
+    0x78, 0x70, 0x78, 0x0c, 0x04, 0x12, 0x84, 0x88,
+    0x84, 0x0c, 0x04, 0x68, 0x38, 0x30, 0x38, 0x0e,
+    0x02, 0x08, 0x38, 0xff, 0x00, 0xa7, 0x01, 0x04,
+    0x1d, 0x04, 0xec, 0x78, 0x70, 0x78, 0x0c, 0x04,
+    0x12, 0x84, 0x88, 0x84, 0x0c, 0x04, 0x68, 0x38,
+    0x30, 0x38, 0x0e, 0x02, 0x08, 0x38, 0xff, 0x00,
+    0xb7, 0x01, 0x04, 0x1d, 0x04, 0xec, 0x78, 0x70,
+    0x78, 0x0c, 0x04, 0x12, 0x84, 0x88, 0x84, 0x0c,
+    0x04, 0x68, 0x38, 0x30, 0x38, 0xff, 0x00, 0xc7,
+    0x01, 0x04, 0x1d, 0x04, 0xec, 0x78, 0x70, 0x78,
+    0x0c, 0x04, 0x12, 0x84, 0x88, 0x84, 0xff, 0x00,
+    0xd7, 0x01, 0x04, 0x1d, 0x04, 0xec, 0x78, 0x70,
+    0x78, 0xff, 0x00, 0xe7, 0x01, 0x04, 0xff, 0x00,
+    0xf7, 0x01, 0x04
+};
+
+static const ElementDeltas element_deltas_mode_mode_mode = {
+    .resource = &resource_mode_mode,
+    .steps = {
+        { {  32, 18,  32, 11 },   47, element_deltas_mode_mode_mode_runs + 0 },
+        { {  32, 19,  32, 11 },   47, element_deltas_mode_mode_mode_runs + 47 },
+        { {  32, 20,  32, 11 },   47, element_deltas_mode_mode_mode_runs + 94 },
+        { {  32, 21,  32, 11 },   47, element_deltas_mode_mode_mode_runs + 141 },
+        { {  32, 22,  32, 10 },   41, element_deltas_mode_mode_mode_runs + 188 },
+        { {  32, 23,  32,  9 },   36, element_deltas_mode_mode_mode_runs + 229 },
+        { {  32, 24,  32,  8 },   31, element_deltas_mode_mode_mode_runs + 265 },
+        { {  32, 25,  32,  6 },   27, element_deltas_mode_mode_mode_runs + 296 },
+        { {  32, 26,  32,  6 },   27, element_deltas_mode_mode_mode_runs + 323 },
+        { {  32, 27,  32,  5 },   23, element_deltas_mode_mode_mode_runs + 350 },
+        { {  32, 28,  32,  4 },   17, element_deltas_mode_mode_mode_runs + 373 },
+        { {  32, 29,  32,  3 },   11, element_deltas_mode_mode_mode_runs + 390 },
+        { {  48, 30,   8,  1 },    5, element_deltas_mode_mode_mode_runs + 401 },
+        { {  48, 31,   8,  1 },    5, element_deltas_mode_mode_mode_runs + 406 },
+        { {   0,  0,   0,  0 },    0, element_deltas_mode_mode_mode_runs + 411 }
+    },
+    .appear = { {   0,  0,   0,  0 },    0, element_deltas_mode_mode_mode_runs + 411 }
+};
+
+// LOGO showing resource_logo_mac
+static const uint8_t element_deltas_logo_logo_mac_runs[1472] = {
+    0x22, 0x01, 0x18, 0x0f, 0x01, 0x28, 0x0f, 0x01,
+    0x50, 0x0f, 0x01, 0x90, 0x0f, 0x01, 0xa0, 0x0e,
+    0x02, 0x01, 0x40, 0x1e, 0x02, 0x84, 0x41, 0x0d,
+    0x01, 0x02, 0x02, 0x01, 0x80, 0x0c, 0x01, 0x04,
+    0x02, 0x01, 0x40, 0x0c, 0x01, 0x08, 0x02, 0x01,
+    0x80, 0x0c, 0x01, 0x10, 0x01, 0x01, 0x01, 0x0d,
+    0x01, 0x10, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x10,
+    0x01, 0x01, 0x02, 0x0d, 0x01, 0x10, 0x01, 0x01,
+    0x02, 0x0d, 0x01, 0x10, 0x01, 0x01, 0x02, 0x0d,
+    0x01, 0x10, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x10,
+    0x01, 0x01, 0x01, 0x0d, 0x01, 0x10, 0x02, 0x01,
+    0x80, 0x0c, 0x01, 0x08, 0x02, 0x01, 0x40, 0x0c,
+    0x01, 0x08, 0x02, 0x01, 0x20, 0x0c, 0x01, 0x08,
+    0x02, 0x01, 0x20, 0x0c, 0x01, 0x04, 0x02, 0x01,
+    0x20, 0x0c, 0x01, 0x02, 0x02, 0x01, 0x20, 0x0c,
+    0x01, 0x02, 0x02, 0x01, 0x40, 0x0c, 0x01, 0x01,
+    0x02, 0x01, 0x80, 0x0d, 0x02, 0x80, 0x01, 0x0e,
+    0x02, 0x42, 0x22, 0x22, 0x01, 0x30, 0x0f, 0x01,
+    0x50, 0x0f, 0x01, 0xa0, 0x0e, 0x02, 0x01, 0x20,
+    0x0e, 0x02, 0x01, 0x40, 0x0e, 0x02, 0x02, 0x80,
+    0x1d, 0x03, 0x01, 0x08, 0x82, 0x0d, 0x01, 0x04,
+    0x01, 0x01, 0x01, 0x0d, 0x01, 0x08, 0x02, 0x01,
+    0x80, 0x0c, 0x01, 0x10, 0x01, 0x01, 0x01, 0x0d,
+    0x01, 0x20, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x20,
+    0x01, 0x01, 0x04, 0x0d, 0x01, 0x20, 0x01, 0x01,
+    0x04, 0x0d, 0x01, 0x20, 0x01, 0x01, 0x04, 0x0d,
+    0x01, 0x20, 0x01, 0x01, 0x04, 0x0d, 0x01, 0x20,
+    0x01, 0x01, 0x02, 0x0d, 0x01, 0x20, 0x01, 0x01,
+    0x02, 0x0d, 0x01, 0x20, 0x01, 0x01, 0x01, 0x0d,
+    0x01, 0x10, 0x02, 0x01, 0x80, 0x0c, 0x01, 0x10,
+    0x02, 0x01, 0x40, 0x0c, 0x01, 0x10, 0x02, 0x01,
+    0x40, 0x0c, 0x01, 0x08, 0x02, 0x01, 0x40, 0x0c,
+    0x01, 0x04, 0x02, 0x01, 0x40, 0x0c, 0x01, 0x04,
+    0x02, 0x01, 0x80, 0x0c, 0x01, 0x02, 0x01, 0x01,
+    0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0e,
+    0x02, 0x84, 0x44, 0x22, 0x01, 0x60, 0x0f, 0x01,
+    0xa0, 0x0e, 0x02, 0x01, 0x40, 0x0e, 0x02, 0x02,
+    0x40, 0x0e, 0x02, 0x02, 0x80, 0x0e, 0x01, 0x05,
+    0x1e, 0x03, 0x02, 0x11, 0x04, 0x0d, 0x01, 0x08,
+    0x01, 0x01, 0x02, 0x0d, 0x01, 0x10, 0x01, 0x01,
+    0x01, 0x0d, 0x01, 0x20, 0x01, 0x01, 0x02, 0x0d,
+    0x01, 0x40, 0x01, 0x01, 0x04, 0x0d, 0x01, 0x40,
+    0x01, 0x01, 0x08, 0x0d, 0x01, 0x40, 0x01, 0x01,
+    0x08, 0x0d, 0x01, 0x40, 0x01, 0x01, 0x08, 0x0d,
+    0x01, 0x40, 0x01, 0x01, 0x08, 0x0d, 0x01, 0x40,
+    0x01, 0x01, 0x04, 0x0d, 0x01, 0x40, 0x01, 0x01,
+    0x04, 0x0d, 0x01, 0x40, 0x01, 0x01, 0x02, 0x0d,
+    0x01, 0x20, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x20,
+    0x02, 0x01, 0x80, 0x0c, 0x01, 0x20, 0x02, 0x01,
+    0x80, 0x0c, 0x01, 0x10, 0x02, 0x01, 0x80, 0x0c,
+    0x01, 0x08, 0x02, 0x01, 0x80, 0x0c, 0x01, 0x08,
+    0x01, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x01,
+    0x02, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x04, 0x0d,
+    0x03, 0x01, 0x08, 0x88, 0x22, 0x01, 0xc0, 0x0e,
+    0x02, 0x01, 0x40, 0x0e, 0x02, 0x02, 0x80, 0x0e,
+    0x02, 0x04, 0x80, 0x0e, 0x01, 0x05, 0x0f, 0x01,
+    0x0a, 0x1e, 0x03, 0x04, 0x22, 0x08, 0x0d, 0x01,
+    0x10, 0x01, 0x01, 0x04, 0x0d, 0x01, 0x20, 0x01,
+    0x01, 0x02, 0x0d, 0x01, 0x40, 0x01, 0x01, 0x04,
+    0x0d, 0x01, 0x80, 0x01, 0x01, 0x08, 0x0d, 0x01,
+    0x80, 0x01, 0x01, 0x10, 0x0d, 0x01, 0x80, 0x01,
+    0x01, 0x10, 0x0d, 0x01, 0x80, 0x01, 0x01, 0x10,
+    0x0d, 0x01, 0x80, 0x01, 0x01, 0x10, 0x0d, 0x01,
+    0x80, 0x01, 0x01, 0x08, 0x0d, 0x01, 0x80, 0x01,
+    0x01, 0x08, 0x0d, 0x01, 0x80, 0x01, 0x01, 0x04,
+    0x0d, 0x01, 0x40, 0x01, 0x01, 0x02, 0x0d, 0x01,
+    0x40, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x40, 0x01,
+    0x01, 0x01, 0x0d, 0x01, 0x20, 0x01, 0x01, 0x01,
+    0x0d, 0x01, 0x10, 0x01, 0x01, 0x01, 0x0d, 0x01,
+    0x10, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x08, 0x01,
+    0x01, 0x04, 0x0d, 0x01, 0x04, 0x01, 0x01, 0x08,
+    0x0d, 0x03, 0x02, 0x11, 0x10, 0x21, 0x02, 0x01,
+    0x80, 0x0e, 0x02, 0x02, 0x80, 0x0e, 0x01, 0x05,
+    0x0f, 0x01, 0x09, 0x0f, 0x01, 0x0a, 0x0f, 0x01,
+    0x14, 0x1e, 0x03, 0x08, 0x44, 0x10, 0x0d, 0x01,
+    0x20, 0x01, 0x01, 0x08, 0x0d, 0x01, 0x40, 0x01,
+    0x01, 0x04, 0x0d, 0x01, 0x80, 0x01, 0x01, 0x08,
+    0x0f, 0x01, 0x10, 0x0f, 0x01, 0x20, 0x0f, 0x01,
+    0x20, 0x0f, 0x01, 0x20, 0x0f, 0x01, 0x20, 0x0f,
+    0x01, 0x10, 0x0f, 0x01, 0x10, 0x0f, 0x01, 0x08,
+    0x0d, 0x01, 0x80, 0x01, 0x01, 0x04, 0x0d, 0x01,
+    0x80, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x80, 0x01,
+    0x01, 0x02, 0x0d, 0x01, 0x40, 0x01, 0x01, 0x02,
+    0x0d, 0x01, 0x20, 0x01, 0x01, 0x02, 0x0d, 0x01,
+    0x20, 0x01, 0x01, 0x04, 0x0d, 0x01, 0x10, 0x01,
+    0x01, 0x08, 0x0d, 0x01, 0x08, 0x01, 0x01, 0x10,
+    0x0d, 0x03, 0x04, 0x22, 0x20, 0x21, 0x01, 0x03,
+    0x0f, 0x01, 0x05, 0x0f, 0x01, 0x0a, 0x0f, 0x01,
+    0x12, 0x0f, 0x01, 0x14, 0x0f, 0x01, 0x28, 0x1e,
+    0x03, 0x10, 0x88, 0x20, 0x0d, 0x01, 0x40, 0x01,
+    0x01, 0x10, 0x0d, 0x01, 0x80, 0x01, 0x01, 0x08,
+    0x0f, 0x01, 0x10, 0x0f, 0x01, 0x20, 0x0f, 0x01,
+    0x40, 0x0f, 0x01, 0x40, 0x0f, 0x01, 0x40, 0x0f,
+    0x01, 0x40, 0x0f, 0x01, 0x20, 0x0f, 0x01, 0x20,
+    0x0f, 0x01, 0x10, 0x0f, 0x01, 0x08, 0x0f, 0x01,
+    0x04, 0x0f, 0x01, 0x04, 0x0d, 0x01, 0x80, 0x01,
+    0x01, 0x04, 0x0d, 0x01, 0x40, 0x01, 0x01, 0x04,
+    0x0d, 0x01, 0x40, 0x01, 0x01, 0x08, 0x0d, 0x01,
+    0x20, 0x01, 0x01, 0x10, 0x0d, 0x01, 0x10, 0x01,
+    0x01, 0x20, 0x0d, 0x03, 0x08, 0x44, 0x40, 0x21,
+    0x01, 0x06, 0x0f, 0x01, 0x0a, 0x0f, 0x01, 0x14,
+    0x0f, 0x01, 0x24, 0x0f, 0x01, 0x28, 0x0f, 0x01,
+    0x50, 0x1e, 0x03, 0x21, 0x10, 0x40, 0x0d, 0x01,
+    0x80, 0x01, 0x01, 0x20, 0x0f, 0x01, 0x10, 0x0f,
+    0x01, 0x20, 0x0f, 0x01, 0x40, 0x0f, 0x01, 0x80,
+    0x0f, 0x01, 0x80, 0x0f, 0x01, 0x80, 0x0f, 0x01,
+    0x80, 0x0f, 0x01, 0x40, 0x0f, 0x01, 0x40, 0x0f,
+    0x01, 0x20, 0x0f, 0x01, 0x10, 0x0f, 0x01, 0x08,
+    0x0f, 0x01, 0x08, 0x0f, 0x01, 0x08, 0x0d, 0x01,
+    0x80, 0x01, 0x01, 0x08, 0x0d, 0x01, 0x80, 0x01,
+    0x01, 0x10, 0x0d, 0x01, 0x40, 0x01, 0x01, 0x20,
+    0x0d, 0x01, 0x20, 0x01, 0x01, 0x40, 0x0d, 0x03,
+    0x10, 0x88, 0x80, 0x21, 0x01, 0x14, 0x0f, 0x01,
+    0x3c, 0x0f, 0x01, 0x78, 0x0f, 0x01, 0xd8, 0x0f,
+    0x01, 0xf0, 0x0e, 0x02, 0x01, 0xe0, 0x1e, 0x03,
+    0xc6, 0x61, 0x80, 0x0f, 0x01, 0xc0, 0x0f, 0x01,
+    0x60, 0x0f, 0x01, 0xc0, 0x0e, 0x02, 0x01, 0x80,
+    0x0e, 0x01, 0x03, 0x0f, 0x01, 0x03, 0x0f, 0x01,
+    0x03, 0x0f, 0x01, 0x03, 0x0f, 0x02, 0x01, 0x80,
+    0x0e, 0x02, 0x01, 0x80, 0x0f, 0x01, 0xc0, 0x0f,
+    0x01, 0x60, 0x0f, 0x01, 0x30, 0x0f, 0x01, 0x30,
+    0x0f, 0x01, 0x30, 0x0f, 0x01, 0x30, 0x0f, 0x01,
+    0x60, 0x0d, 0x01, 0x80, 0x01, 0x01, 0xc0, 0x0d,
+    0x03, 0xc0, 0x01, 0x80, 0x0d, 0x02, 0x63, 0x33,
+    0x21, 0x01, 0x50, 0x0f, 0x01, 0xf0, 0x0e, 0x02,
+    0x01, 0xe0, 0x0e, 0x02, 0x03, 0x60, 0x0e, 0x02,
+    0x03, 0xc0, 0x0e, 0x02, 0x07, 0x80, 0x1e, 0x02,
+    0x19, 0x86, 0x0f, 0x01, 0x03, 0x0f, 0x02, 0x01,
+    0x80, 0x0e, 0x01, 0x03, 0x0f, 0x01, 0x06, 0x0f,
+    0x01, 0x0c, 0x0f, 0x01, 0x0c, 0x0f, 0x01, 0x0c,
+    0x0f, 0x01, 0x0c, 0x0f, 0x01, 0x06, 0x0f, 0x01,
+    0x06, 0x0f, 0x01, 0x03, 0x0f, 0x02, 0x01, 0x80,
+    0x0f, 0x01, 0xc0, 0x0f, 0x01, 0xc0, 0x0f, 0x01,
+    0xc0, 0x0f, 0x01, 0xc0, 0x0e, 0x02, 0x01, 0x80,
+    0x0e, 0x01, 0x03, 0x0f, 0x01, 0x06, 0x0e, 0x02,
+    0x8c, 0xcc, 0x20, 0x02, 0x01, 0x40, 0x0e, 0x02,
+    0x03, 0xc0, 0x0e, 0x02, 0x07, 0x80, 0x0e, 0x02,
+    0x0d, 0x80, 0x0e, 0x01, 0x0f, 0x0f, 0x01, 0x1e,
+    0x1f, 0x02, 0x66, 0x18, 0x0f, 0x01, 0x0c, 0x0f,
+    0x01, 0x06, 0x0f, 0x01, 0x0c, 0x0f, 0x01, 0x18,
+    0x0f, 0x01, 0x30, 0x0f, 0x01, 0x30, 0x0f, 0x01,
+    0x30, 0x0f, 0x01, 0x30, 0x0f, 0x01, 0x18, 0x0f,
+    0x01, 0x18, 0x0f, 0x01, 0x0c, 0x0f, 0x01, 0x06,
+    0x0f, 0x01, 0x03, 0x0f, 0x01, 0x03, 0x0f, 0x01,
+    0x03, 0x0f, 0x01, 0x03, 0x0f, 0x01, 0x06, 0x0f,
+    0x01, 0x0c, 0x0f, 0x01, 0x18, 0x0e, 0x02, 0x33,
+    0x30, 0x20, 0x01, 0x05, 0x0f, 0x01, 0x0f, 0x0f,
+    0x01, 0x1e, 0x0f, 0x01, 0x36, 0x0f, 0x01, 0x3c,
+    0x0f, 0x01, 0x78, 0x1f, 0x02, 0x98, 0x60, 0x0f,
+    0x01, 0x30, 0x0f, 0x01, 0x18, 0x0f, 0x01, 0x30,
+    0x0f, 0x01, 0x60, 0x0f, 0x01, 0xc0, 0x0f, 0x01,
+    0xc0, 0x0f, 0x01, 0xc0, 0x0f, 0x01, 0xc0, 0x0f,
+    0x01, 0x60, 0x0f, 0x01, 0x60, 0x0f, 0x01, 0x30,
+    0x0f, 0x01, 0x18, 0x0f, 0x01, 0x0c, 0x0f, 0x01,
+    0x0c, 0x0f, 0x01, 0x0c, 0x0f, 0x01, 0x0c, 0x0f,
+    0x01, 0x18, 0x0f, 0x01, 0x30, 0x0f, 0x01, 0x60,
+    0x0e, 0x02, 0xcc, 0xc0, 0x20, 0x01, 0x24, 0x0f,
+    0x01, 0x6c, 0x0f, 0x01, 0xd8, 0x0f, 0x01, 0xf8,
+    0x0f, 0x01, 0xb0, 0x0f, 0x01, 0x60, 0x1f, 0x02,
+    0xe3, 0x80, 0x0e, 0x02, 0x01, 0xc0, 0x0f, 0x01,
+    0xe0, 0x0e, 0x02, 0x01, 0xc0, 0x0e, 0x02, 0x03,
+    0x80, 0x0e, 0x01, 0x07, 0x0f, 0x01, 0x07, 0x0f,
+    0x01, 0x07, 0x0f, 0x01, 0x07, 0x0f, 0x02, 0x03,
+    0x80, 0x0e, 0x02, 0x03, 0x80, 0x0e, 0x02, 0x01,
+    0xc0, 0x0f, 0x01, 0xe0, 0x0f, 0x01, 0x70, 0x0f,
+    0x01, 0x70, 0x0f, 0x01, 0x70, 0x0f, 0x01, 0x70,
+    0x0f, 0x01, 0xe0, 0x0e, 0x02, 0x01, 0xc0, 0x0e,
+    0x02, 0x03, 0x80, 0x0e, 0x01, 0x77, 0x20, 0x01,
+    0x20, 0x0f, 0x01, 0x60, 0x0f, 0x01, 0xc0, 0x0f,
+    0x01, 0xc0, 0x0f, 0x01, 0x80, 0x2f, 0x01, 0x7c,
+    0x0f, 0x01, 0x3e, 0x0f, 0x01, 0x1f, 0x0f, 0x01,
+    0x3e, 0x0f, 0x01, 0x7c, 0x0f, 0x01, 0xf8, 0x0f,
+    0x01, 0xf8, 0x0f, 0x01, 0xf8, 0x0f, 0x01, 0xf8,
+    0x0f, 0x01, 0x7c, 0x0f, 0x01, 0x7c, 0x0f, 0x01,
+    0x3e, 0x0f, 0x01, 0x1f, 0x0f, 0x02, 0x0f, 0x80,
+    0x0e, 0x02, 0x0f, 0x80, 0x0e, 0x02, 0x0f, 0x80,
+    0x0e, 0x02, 0x0f, 0x80, 0x0e, 0x01, 0x1f, 0x0f,
+    0x01, 0x3e, 0x0f, 0x01, 0x7c, 0x0f, 0x01, 0x78,
+    0x90, 0x01, 0x80, 0x0f, 0x01, 0xc0, 0x0f, 0x01,
+    0xe0, 0x0f, 0x01, 0xc0, 0x0f, 0x01, 0x80, 0x4f,
+    0x01, 0x80, 0x0f, 0x01, 0x80, 0x0f, 0x01, 0xc0,
+    0x0f, 0x01, 0xe0, 0x0f, 0x01, 0xf0, 0x0f, 0x01,
+    0xf0, 0x0f, 0x01, 0xf0, 0x0f, 0x01, 0xf0, 0x0f,
+    0x01, 0xe0, 0x0f, 0x01, 0xc0, 0x0f, 0x01, 0x80
+};
+
+static const ElementDeltas element_deltas_logo_logo_mac = {
+    .resource = &resource_logo_mac,
+    .steps = {
+        { {   0,  2,  32, 28 },  139, element_deltas_logo_logo_mac_runs + 0 },
+        { {   0,  0,   0,  0 },    0, element_deltas_logo_logo_mac_runs + 139 },
+        { {   0,  2,  32, 28 },  144, element_deltas_logo_logo_mac_runs + 139 },
+        { {   0,  2,  32, 28 },  145, element_deltas_logo_logo_mac_runs + 283 },
+        { {   0,  2,  24, 28 },  145, element_deltas_logo_logo_mac_runs + 428 },
+        { {   0,  2,  24, 28 },  120, element_deltas_logo_logo_mac_runs + 573 },
+        { {   0,  2,  24, 28 },  106, element_deltas_logo_logo_mac_runs + 693 },
+        { {   0,  2,  24, 28 },  100, element_deltas_logo_logo_mac_runs + 799 },
+        { {   0,  2,  24, 28 },   93, element_deltas_logo_logo_mac_runs + 899 },
+        { {   0,  2,  24, 28 },   90, element_deltas_logo_logo_mac_runs + 992 },
+        { {   0,  2,  16, 28 },   87, element_deltas_logo_logo_mac_runs + 1082 },
+        { {   0,  2,  16, 28 },   83, element_deltas_logo_logo_mac_runs + 1169 },
+        { {   0,  2,  16, 28 },   90, element_deltas_logo_logo_mac_runs + 1252 },
+        { {   0,  2,  16, 28 },   82, element_deltas_logo_logo_mac_runs + 1342 },
+        { {   0,  9,   8, 20 },   48, element_deltas_logo_logo_mac_runs + 1424 }
+    },
+    .appear = { {   0,  0,   0,  0 },    0, element_deltas_logo_logo_mac_runs + 1472 }
+};
+
+// NAME showing resource_name_mac
+static const uint8_t element_deltas_name_name_mac_runs[569] = {
+    0x27, 0x01, 0x78, 0x0f, 0x01, 0x84, 0x0c, 0x05,
+    0xec, 0x78, 0x78, 0x38, 0x78, 0x0b, 0x03, 0x12,
+    0x84, 0x84, 0x01, 0x01, 0x84, 0x0b, 0x03, 0x68,
+    0xf8, 0x38, 0x01, 0x01, 0x3c, 0x0c, 0x02, 0x78,
+    0x04, 0x01, 0x01, 0xb0, 0x0c, 0x01, 0x80, 0x02,
+    0x01, 0x4c, 0x0c, 0x02, 0x38, 0x04, 0x01, 0x01,
+    0x38, 0x0c, 0x04, 0x38, 0x38, 0x38, 0xe8, 0x0c,
+    0x04, 0x88, 0x84, 0x84, 0x94, 0x0b, 0x05, 0x96,
+    0x74, 0x78, 0x78, 0x78, 0x17, 0x01, 0x78, 0x0f,
+    0x01, 0x84, 0x0c, 0x05, 0xec, 0x78, 0x78, 0x38,
+    0x78, 0x0b, 0x03, 0x12, 0x84, 0x84, 0x01, 0x01,
+    0x84, 0x0b, 0x03, 0x68, 0xf8, 0x38, 0x01, 0x01,
+    0x3c, 0x0c, 0x02, 0x78, 0x04, 0x01, 0x01, 0xb0,
+    0x0c, 0x01, 0x80, 0x02, 0x01, 0x4c, 0x0c, 0x02,
+    0x38, 0x04, 0x01, 0x01, 0x38, 0x0c, 0x04, 0x38,
+    0x38, 0x38, 0xe8, 0x0c, 0x04, 0x88, 0x84, 0x84,
+    0x94, 0x0b, 0x05, 0x96, 0x74, 0x78, 0x78, 0x78,
+    0x07, 0x01, 0x78, 0x0f, 0x01, 0x84, 0x0c, 0x05,
+    0xec, 0x78, 0x78, 0x38, 0x78, 0x0b, 0x03, 0x12,
+    0x84, 0x84, 0x01, 0x01, 0x84, 0x0b, 0x03, 0x68,
+    0xf8, 0x38, 0x01, 0x01, 0x3c, 0x0c, 0x02, 0x78,
+    0x04, 0x01, 0x01, 0xb0, 0x0c, 0x01, 0x80, 0x02,
+    0x01, 0x4c, 0x0c, 0x02, 0x38, 0x04, 0x01, 0x01,
+    0x38, 0x0c, 0x04, 0x38, 0x38, 0x38, 0xe8, 0x0c,
+    0x04, 0x88, 0x84, 0x84, 0x94, 0x0b, 0x05, 0x96,
+    0x74, 0x78, 0x78, 0x78, 0x07, 0x01, 0x84, 0x0c,
+    0x05, 0xec, 0x78, 0x78, 0x38, 0x78, 0x0b, 0x03,
+    0x12, 0x84, 0x84, 0x01, 0x01, 0x84, 0x0b, 0x03,
+    0x68, 0xf8, 0x38, 0x01, 0x01, 0x3c, 0x0c, 0x02,
+    0x78, 0x04, 0x01, 0x01, 0xb0, 0x0c, 0x01, 0x80,
+    0x02, 0x01, 0x4c, 0x0c, 0x02, 0x38, 0x04, 0x01,
+    0x01, 0x38, 0x0c, 0x04, 0x38, 0x38, 0x38, 0xe8,
+    0x0c, 0x04, 0x88, 0x84, 0x84, 0x94, 0x0b, 0x05,
+    0x96, 0x74, 0x78, 0x78, 0x78, 0x04, 0x05, 0xec,
+    0x78, 0x78, 0x38, 0x78, 0x0b, 0x03, 0x12, 0x84,
+    0x84, 0x01, 0x01, 0x84, 0x0b, 0x03, 0x68, 0xf8,
+    0x38, 0x01, 0x01, 0x3c, 0x0c, 0x02, 0x78, 0x04,
+    0x01, 0x01, 0xb0, 0x0c, 0x01, 0x80, 0x02, 0x01,
+    0x4c, 0x0c, 0x02, 0x38, 0x04, 0x01, 0x01, 0x38,
+    0x0c, 0x04, 0x38, 0x38, 0x38, 0xe8, 0x0c, 0x04,
+    0x88, 0x84, 0x84, 0x94, 0x0b, 0x05, 0x96, 0x74,
+    0x78, 0x78, 0x78, 0x04, 0x03, 0x12, 0x84, 0x84,
+    0x01, 0x01, 0x84, 0x0b, 0x03, 0x68, 0xf8, 0x38,
+    0x01, 0x01, 0x3c, 0x0c, 0x02, 0x78, 0x04, 0x01,
+    0x01, 0xb0, 0x0c, 0x01, 0x80, 0x02, 0x01, 0x4c,
+    0x0c, 0x02, 0x38, 0x04, 0x01, 0x01, 0x38, 0x0c,
+    0x04, 0x38, 0x38, 0x38, 0xe8, 0x0c, 0x04, 0x88,
+    0x84, 0x84, 0x94, 0x0b, 0x05, 0x96, 0x74, 0x78,
+    0x78, 0x78, 0x04, 0x03, 0x68, 0xf8, 0x38, 0x01,
+    0x01, 0x3c, 0x0c, 0x02, 0x78, 0x04, 0x01, 0x01,
+    0xb0, 0x0c, 0x01, 0x80, 0x02, 0x01, 0x4c, 0x0c,
+    0x02, 0x38, 0x04, 0x01, 0x01, 0x38, 0x0c, 0x04,
+    0x38, 0x38, 0x38, 0xe8, 0x0c, 0x04, 0x88, 0x84,
+    0x84, 0x94, 0x0b, 0x05, 0x96, 0x74, 0x78, 0x78,
+    0x78, 0x05, 0x02, 0x78, 0x04, 0x01, 0x01, 0xb0,
+    0x0c, 0x01, 0x80, 0x02, 0x01, 0x4c, 0x0c, 0x02,
+    0x38, 0x04, 0x01, 0x01, 0x38, 0x0c, 0x04, 0x38,
+    0x38, 0x38, 0xe8, 0x0c, 0x04, 0x88, 0x84, 0x84,
+    0x94, 0x0b, 0x05, 0x96, 0x74, 0x78, 0x78, 0x78,
+    0x05, 0x01, 0x80, 0x02, 0x01, 0x4c, 0x0c, 0x02,
+    0x38, 0x04, 0x01, 0x01, 0x38, 0x0c, 0x04, 0x38,
+    0x38, 0x38, 0xe8, 0x0c, 0x04, 0x88, 0x84, 0x84,
+    0x94, 0x0b, 0x05, 0x96, 0x74, 0x78, 0x78, 0x78,
+    0x05, 0x02, 0x38, 0x04, 0x01, 0x01, 0x38, 0x0c,
+    0x04, 0x38, 0x38, 0x38, 0xe8, 0x0c, 0x04, 0x88,
+    0x84, 0x84, 0x94, 0x0b, 0x05, 0x96, 0x74, 0x78,
+    0x78, 0x78, 0x05, 0x04, 0x38, 0x38, 0x38, 0xe8,
+    0x0c, 0x04, 0x88, 0x84, 0x84, 0x94, 0x0b, 0x05,
+    0x96, 0x74, 0x78, 0x78, 0x78, 0x05, 0x04, 0x88,
+    0x84, 0x84, 0x94, 0x0b, 0x05, 0x96, 0x74, 0x78,
+    0x78, 0x78, 0x04, 0x05, 0x96, 0x74, 0x78, 0x78,
+    0x78
+};
+
+static const ElementDeltas element_deltas_name_name_mac = {
+    .resource = &resource_name_mac,
+    .steps = {
+        { {  32,  2,  40, 11 },   68, element_deltas_name_name_mac_runs + 0 },
+        { {  32,  1,  40, 11 },   68, element_deltas_name_name_mac_runs + 68 },
+        { {  32,  0,  40, 11 },   68, element_deltas_name_name_mac_runs + 136 },
+        { {  32,  0,  40, 10 },   65, element_deltas_name_name_mac_runs + 204 },
+        { {  32,  0,  40,  9 },   62, element_deltas_name_name_mac_runs + 269 },
+        { {  32,  0,  40,  8 },   55, element_deltas_name_name_mac_runs + 331 },
+        { {  32,  0,  40,  7 },   47, element_deltas_name_name_mac_runs + 386 },
+        { {  32,  0,  40,  6 },   39, element_deltas_name_name_mac_runs + 433 },
+        { {  32,  0,  40,  5 },   32, element_deltas_name_name_mac_runs + 472 },
+        { {  32,  0,  40,  4 },   26, element_deltas_name_name_mac_runs + 504 },
+        { {  32,  0,  40,  3 },   19, element_deltas_name_name_mac_runs + 530 },
+        { {  32,  0,  40,  2 },   13, element_deltas_name_name_mac_runs + 549 },
+        { {  32,  0,  40,  1 },    7, element_deltas_name_name_mac_runs + 562 },
+        { {   0,  0,   0,  0 },    0, element_deltas_name_name_mac_runs + 569 },
+        { {   0,  0,   0,  0 },    0, element_deltas_name_name_mac_runs + 569 }
+    },
+    .appear = { {   0,  0,   0,  0 },    0, element_deltas_name_name_mac_runs + 569 }
+};
+
+// NAME showing resource_name_gam
+static const uint8_t element_deltas_name_name_gam_runs[785] = {
+    0x24, 0x01, 0x3c, 0x02, 0x01, 0x18, 0x0c, 0x01,
+    0x42, 0x02, 0x01, 0x18, 0x0c, 0x06, 0x1c, 0x3c,
+    0x76, 0x78, 0x6c, 0x3a, 0x0a, 0x06, 0x02, 0x42,
+    0x09, 0x40, 0x12, 0x44, 0x0a, 0x06, 0x0e, 0x7c,
+    0x34, 0x30, 0x18, 0x18, 0x0a, 0x02, 0x01, 0x3c,
+    0x02, 0x02, 0x04, 0x04, 0x0a, 0x02, 0x0d, 0x40,
+    0x0f, 0x01, 0x1c, 0x0e, 0x02, 0x1c, 0x1c, 0x01,
+    0x01, 0x76, 0x01, 0x01, 0x04, 0x0a, 0x02, 0x42,
+    0x44, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x0a,
+    0x06, 0x3c, 0x3a, 0x4b, 0x7f, 0x62, 0x3c, 0x0f,
+    0x01, 0x4c, 0x0f, 0x01, 0x72, 0x0f, 0x01, 0x3c,
+    0x14, 0x01, 0x3c, 0x02, 0x01, 0x18, 0x0c, 0x01,
+    0x42, 0x02, 0x01, 0x18, 0x0c, 0x06, 0x1c, 0x3c,
+    0x76, 0x78, 0x6c, 0x3a, 0x0a, 0x06, 0x02, 0x42,
+    0x09, 0x40, 0x12, 0x44, 0x0a, 0x06, 0x0e, 0x7c,
+    0x34, 0x30, 0x18, 0x18, 0x0a, 0x02, 0x01, 0x3c,
+    0x02, 0x02, 0x04, 0x04, 0x0a, 0x02, 0x0d, 0x40,
+    0x0f, 0x01, 0x1c, 0x0e, 0x02, 0x1c, 0x1c, 0x01,
+    0x01, 0x76, 0x01, 0x01, 0x04, 0x0a, 0x02, 0x42,
+    0x44, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x0a,
+    0x06, 0x3c, 0x3a, 0x4b, 0x7f, 0x62, 0x3c, 0x0f,
+    0x01, 0x4c, 0x0f, 0x01, 0x72, 0x0f, 0x01, 0x3c,
+    0x04, 0x01, 0x3c, 0x02, 0x01, 0x18, 0x0c, 0x01,
+    0x42, 0x02, 0x01, 0x18, 0x0c, 0x06, 0x1c, 0x3c,
+    0x76, 0x78, 0x6c, 0x3a, 0x0a, 0x06, 0x02, 0x42,
+    0x09, 0x40, 0x12, 0x44, 0x0a, 0x06, 0x0e, 0x7c,
+    0x34, 0x30, 0x18, 0x18, 0x0a, 0x02, 0x01, 0x3c,
+    0x02, 0x02, 0x04, 0x04, 0x0a, 0x02, 0x0d, 0x40,
+    0x0f, 0x01, 0x1c, 0x0e, 0x02, 0x1c, 0x1c, 0x01,
+    0x01, 0x76, 0x01, 0x01, 0x04, 0x0a, 0x02, 0x42,
+    0x44, 0x01, 0x01, 0x01, 0x01, 0x01, 0x58, 0x0a,
+    0x06, 0x3c, 0x3a, 0x4b, 0x7f, 0x62, 0x3c, 0x0f,
+    0x01, 0x4c, 0x0f, 0x01, 0x72, 0x0f, 0x01, 0x3c,
+    0x04, 0x01, 0x42, 0x02, 0x01, 0x18, 0x0c, 0x06,
+    0x1c, 0x3c, 0x76, 0x78, 0x6c, 0x3a, 0x0a, 0x06,
+    0x02, 0x42, 0x09, 0x40, 0x12, 0x44, 0x0a, 0x06,
+    0x0e, 0x7c, 0x34, 0x30, 0x18, 0x18, 0x0a, 0x02,
+    0x01, 0x3c, 0x02, 0x02, 0x04, 0x04, 0x0a, 0x02,
+    0x0d, 0x40, 0x0f, 0x01, 0x1c, 0x0e, 0x02, 0x1c,
+    0x1c, 0x01, 0x01, 0x76, 0x01, 0x01, 0x04, 0x0a,
+    0x02, 0x42, 0x44, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x58, 0x0a, 0x06, 0x3c, 0x3a, 0x4b, 0x7f, 0x62,
+    0x3c, 0x0f, 0x01, 0x4c, 0x0f, 0x01, 0x72, 0x0f,
+    0x01, 0x3c, 0x04, 0x06, 0x1c, 0x3c, 0x76, 0x78,
+    0x6c, 0x3a, 0x0a, 0x06, 0x02, 0x42, 0x09, 0x40,
+    0x12, 0x44, 0x0a, 0x06, 0x0e, 0x7c, 0x34, 0x30,
+    0x18, 0x18, 0x0a, 0x02, 0x01, 0x3c, 0x02, 0x02,
+    0x04, 0x04, 0x0a, 0x02, 0x0d, 0x40, 0x0f, 0x01,
+    0x1c, 0x0e, 0x02, 0x1c, 0x1c, 0x01, 0x01, 0x76,
+    0x01, 0x01, 0x04, 0x0a, 0x02, 0x42, 0x44, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x58, 0x0a, 0x06, 0x3c,
+    0x3a, 0x4b, 0x7f, 0x62, 0x3c, 0x0f, 0x01, 0x4c,
+    0x0f, 0x01, 0x72, 0x0f, 0x01, 0x3c, 0x04, 0x06,
+    0x02, 0x42, 0x09, 0x40, 0x12, 0x44, 0x0a, 0x06,
+    0x0e, 0x7c, 0x34, 0x30, 0x18, 0x18, 0x0a, 0x02,
+    0x01, 0x3c, 0x02, 0x02, 0x04, 0x04, 0x0a, 0x02,
+    0x0d, 0x40, 0x0f, 0x01, 0x1c, 0x0e, 0x02, 0x1c,
+    0x1c, 0x01, 0x01, 0x76, 0x01, 0x01, 0x04, 0x0a,
+    0x02, 0x42, 0x44, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x58, 0x0a, 0x06, 0x3c, 0x3a, 0x4b, 0x7f, 0x62,
+    0x3c, 0x0f, 0x01, 0x4c, 0x0f, 0x01, 0x72, 0x0f,
+    0x01, 0x3c, 0x04, 0x06, 0x0e, 0x7c, 0x34, 0x30,
+    0x18, 0x18, 0x0a, 0x02, 0x01, 0x3c, 0x02, 0x02,
+    0x04, 0x04, 0x0a, 0x02, 0x0d, 0x40, 0x0f, 0x01,
+    0x1c, 0x0e, 0x02, 0x1c, 0x1c, 0x01, 0x01, 0x76,
+    0x01, 0x01, 0x04, 0x0a, 0x02, 0x42, 0x44, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x58, 0x0a, 0x06, 0x3c,
+    0x3a, 0x4b, 0x7f, 0x62, 0x3c, 0x0f, 0x01, 0x4c,
+    0x0f, 0x01, 0x72, 0x0f, 0x01, 0x3c, 0x04, 0x02,
+    0x01, 0x3c, 0x02, 0x02, 0x04, 0x04, 0x0a, 0x02,
+    0x0d, 0x40, 0x0f, 0x01, 0x1c, 0x0e, 0x02, 0x1c,
+    0x1c, 0x01, 0x01, 0x76, 0x01, 0x01, 0x04, 0x0a,
+    0x02, 0x42, 0x44, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x58, 0x0a, 0x06, 0x3c, 0x3a, 0x4b, 0x7f, 0x62,
+    0x3c, 0x0f, 0x01, 0x4c, 0x0f, 0x01, 0x72, 0x0f,
+    0x01, 0x3c, 0x04, 0x02, 0x0d, 0x40, 0x0f, 0x01,
+    0x1c, 0x0e, 0x02, 0x1c, 0x1c, 0x01, 0x01, 0x76,
+    0x01, 0x01, 0x04, 0x0a, 0x02, 0x42, 0x44, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x58, 0x0a, 0x06, 0x3c,
+    0x3a, 0x4b, 0x7f, 0x62, 0x3c, 0x0f, 0x01, 0x4c,
+    0x0f, 0x01, 0x72, 0x0f, 0x01, 0x3c, 0x05, 0x01,
+    0x1c, 0x0e, 0x02, 0x1c, 0x1c, 0x01, 0x01, 0x76,
+    0x01, 0x01, 0x04, 0x0a, 0x02, 0x42, 0x44, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x58, 0x0a, 0x06, 0x3c,
+    0x3a, 0x4b, 0x7f, 0x62, 0x3c, 0x0f, 0x01, 0x4c,
+    0x0f, 0x01, 0x72, 0x0f, 0x01, 0x3c, 0x04, 0x02,
+    0x1c, 0x1c, 0x01, 0x01, 0x76, 0x01, 0x01, 0x04,
+    0x0a, 0x02, 0x42, 0x44, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x58, 0x0a, 0x06, 0x3c, 0x3a, 0x4b, 0x7f,
+    0x62, 0x3c, 0x0f, 0x01, 0x4c, 0x0f, 0x01, 0x72,
+    0x0f, 0x01, 0x3c, 0x04, 0x02, 0x42, 0x44, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x58, 0x0a, 0x06, 0x3c,
+    0x3a, 0x4b, 0x7f, 0x62, 0x3c, 0x0f, 0x01, 0x4c,
+    0x0f, 0x01, 0x72, 0x0f, 0x01, 0x3c, 0x04, 0x06,
+    0x3c, 0x3a, 0x4b, 0x7f, 0x62, 0x3c, 0x0f, 0x01,
+    0x4c, 0x0f, 0x01, 0x72, 0x0f, 0x01, 0x3c, 0x09,
+    0x01, 0x4c, 0x0f, 0x01, 0x72, 0x0f, 0x01, 0x3c,
+    0x09, 0x01, 0x72, 0x0f, 0x01, 0x3c, 0x09, 0x01,
+    0x3c
+};
+
+static const ElementDeltas element_deltas_name_name_gam = {
+    .resource = &resource_name_gam,
+    .steps = {
+        { {  32,  2,  48, 14 },   88, element_deltas_name_name_gam_runs + 0 },
+        { {  32,  1,  48, 14 },   88, element_deltas_name_name_gam_runs + 88 },
+        { {  32,  0,  48, 14 },   88, element_deltas_name_name_gam_runs + 176 },
+        { {  32,  0,  48, 13 },   82, element_deltas_name_name_gam_runs + 264 },
+        { {  32,  0,  48, 12 },   76, element_deltas_name_name_gam_runs + 346 },
+        { {  32,  0,  48, 11 },   68, element_deltas_name_name_gam_runs + 422 },
+        { {  32,  0,  48, 10 },   60, element_deltas_name_name_gam_runs + 490 },
+        { {  32,  0,  48,  9 },   52, element_deltas_name_name_gam_runs + 550 },
+        { {  32,  0,  48,  8 },   44, element_deltas_name_name_gam_runs + 602 },
+        { {  32,  0,  48,  7 },   40, element_deltas_name_name_gam_runs + 646 },
+        { {  32,  0,  48,  6 },   37, element_deltas_name_name_gam_runs + 686 },
+        { {  32,  0,  48,  5 },   27, element_deltas_name_name_gam_runs + 723 },
+        { {  32,  0,  48,  4 },   17, element_deltas_name_name_gam_runs + 750 },
+        { {  72,  0,   8,  3 },    9, element_deltas_name_name_gam_runs + 767 },
+        { {  72,  0,   8,  2 },    6, element_deltas_name_name_gam_runs + 776 }
+    },
+    .appear = { {  72,  0,   8,  1 },    3, element_deltas_name_name_gam_runs + 782 }
+};
+
+// LAYER_SYMBOL showing resource_symbol_controller
+static const uint8_t element_deltas_layer_symbol_symbol_controller_runs[1112] = {
+    0x5e, 0x01, 0x12, 0x0f, 0x02, 0x33, 0xc0, 0x0e,
+    0x02, 0x61, 0x80, 0x0e, 0x01, 0x60, 0x0f, 0x01,
+    0x60, 0x0e, 0x02, 0x18, 0x63, 0x0e, 0x03, 0x42,
+    0x68, 0x40, 0x0d, 0x01, 0x80, 0x01, 0x01, 0x20,
+    0x0c, 0x01, 0x01, 0x02, 0x01, 0x10, 0x0c, 0x04,
+    0x01, 0x28, 0x01, 0x90, 0x0c, 0x04, 0x01, 0x29,
+    0x9b, 0xd0, 0x0c, 0x04, 0x02, 0x06, 0x01, 0x88,
+    0x0c, 0x04, 0x02, 0x09, 0x0a, 0x08, 0x0c, 0x04,
+    0x02, 0x06, 0x0a, 0x08, 0x0c, 0x01, 0x04, 0x02,
+    0x01, 0x04, 0x0c, 0x01, 0x04, 0x02, 0x01, 0x04,
+    0x0c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0c, 0x04,
+    0x04, 0x08, 0x02, 0x04, 0x0c, 0x04, 0x04, 0x10,
+    0x01, 0x04, 0x0c, 0x02, 0x02, 0x20, 0x01, 0x01,
+    0x88, 0x5e, 0x01, 0x09, 0x0f, 0x02, 0x19, 0xe0,
+    0x0e, 0x02, 0x30, 0xc0, 0x0e, 0x01, 0x30, 0x0f,
+    0x01, 0x30, 0x0e, 0x03, 0x0c, 0x31, 0x80, 0x0d,
+    0x03, 0x21, 0x34, 0x20, 0x0d, 0x01, 0x40, 0x01,
+    0x01, 0x10, 0x0d, 0x01, 0x80, 0x01, 0x01, 0x08,
+    0x0d, 0x01, 0x94, 0x01, 0x01, 0xc8, 0x0d, 0x03,
+    0x94, 0xcd, 0xe8, 0x0c, 0x02, 0x01, 0x03, 0x01,
+    0x01, 0xc4, 0x0c, 0x04, 0x01, 0x04, 0x85, 0x04,
+    0x0c, 0x04, 0x01, 0x03, 0x05, 0x04, 0x0c, 0x01,
+    0x02, 0x02, 0x01, 0x02, 0x0c, 0x01, 0x02, 0x02,
+    0x01, 0x02, 0x0c, 0x04, 0x02, 0x02, 0x02, 0x02,
+    0x0c, 0x04, 0x02, 0x04, 0x01, 0x02, 0x0c, 0x02,
+    0x02, 0x08, 0x01, 0x01, 0x82, 0x0c, 0x02, 0x01,
+    0x10, 0x01, 0x01, 0x44, 0x5e, 0x02, 0x04, 0x80,
+    0x0e, 0x02, 0x0c, 0xf0, 0x0e, 0x02, 0x18, 0x60,
+    0x0e, 0x01, 0x18, 0x0f, 0x01, 0x18, 0x0e, 0x03,
+    0x06, 0x18, 0xc0, 0x0d, 0x03, 0x10, 0x9a, 0x10,
+    0x0d, 0x01, 0x20, 0x01, 0x01, 0x08, 0x0d, 0x01,
+    0x40, 0x01, 0x01, 0x04, 0x0d, 0x01, 0x4a, 0x01,
+    0x01, 0x64, 0x0d, 0x03, 0x4a, 0x66, 0xf4, 0x0d,
+    0x03, 0x81, 0x80, 0x62, 0x0d, 0x03, 0x82, 0x42,
+    0x82, 0x0d, 0x03, 0x81, 0x82, 0x82, 0x0c, 0x01,
+    0x01, 0x02, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x02,
+    0x01, 0x01, 0x0c, 0x04, 0x01, 0x01, 0x01, 0x01,
+    0x0c, 0x02, 0x01, 0x02, 0x01, 0x01, 0x81, 0x0c,
+    0x02, 0x01, 0x04, 0x01, 0x01, 0x41, 0x0d, 0x01,
+    0x88, 0x01, 0x01, 0x22, 0x5e, 0x02, 0x02, 0x40,
+    0x0e, 0x02, 0x06, 0x78, 0x0e, 0x02, 0x0c, 0x30,
+    0x0e, 0x01, 0x0c, 0x0f, 0x01, 0x0c, 0x0e, 0x03,
+    0x03, 0x0c, 0x60, 0x0d, 0x03, 0x08, 0x4d, 0x08,
+    0x0d, 0x01, 0x10, 0x01, 0x01, 0x04, 0x0d, 0x01,
+    0x20, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x25, 0x01,
+    0x01, 0x32, 0x0d, 0x03, 0x25, 0x33, 0x7a, 0x0d,
+    0x03, 0x40, 0xc0, 0x31, 0x0d, 0x03, 0x41, 0x21,
+    0x41, 0x0d, 0x03, 0x40, 0xc1, 0x41, 0x0d, 0x01,
+    0x80, 0x0f, 0x01, 0x80, 0x0f, 0x03, 0x80, 0x80,
+    0x80, 0x0d, 0x01, 0x81, 0x01, 0x01, 0x40, 0x0d,
+    0x01, 0x82, 0x01, 0x01, 0x20, 0x0d, 0x01, 0x44,
+    0x01, 0x01, 0x11, 0x5e, 0x02, 0x01, 0x20, 0x0e,
+    0x02, 0x03, 0x3c, 0x0e, 0x02, 0x06, 0x18, 0x0e,
+    0x01, 0x06, 0x0f, 0x01, 0x06, 0x0e, 0x03, 0x01,
+    0x86, 0x30, 0x0d, 0x03, 0x04, 0x26, 0x84, 0x0d,
+    0x01, 0x08, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x10,
+    0x01, 0x01, 0x01, 0x0d, 0x03, 0x12, 0x80, 0x19,
+    0x0d, 0x03, 0x12, 0x99, 0xbd, 0x0d, 0x03, 0x20,
+    0x60, 0x18, 0x0d, 0x03, 0x20, 0x90, 0xa0, 0x0d,
+    0x03, 0x20, 0x60, 0xa0, 0x0d, 0x01, 0x40, 0x0f,
+    0x01, 0x40, 0x0f, 0x03, 0x40, 0x40, 0x40, 0x0d,
+    0x03, 0x40, 0x80, 0x20, 0x0d, 0x01, 0x41, 0x01,
+    0x01, 0x10, 0x0d, 0x01, 0x22, 0x01, 0x01, 0x08,
+    0x5f, 0x01, 0x90, 0x0e, 0x02, 0x01, 0x9e, 0x0e,
+    0x02, 0x03, 0x0c, 0x0e, 0x01, 0x03, 0x0f, 0x01,
+    0x03, 0x0f, 0x02, 0xc3, 0x18, 0x0d, 0x03, 0x02,
+    0x13, 0x42, 0x0d, 0x01, 0x04, 0x01, 0x01, 0x01,
+    0x0d, 0x01, 0x08, 0x0f, 0x03, 0x09, 0x40, 0x0c,
+    0x0d, 0x03, 0x09, 0x4c, 0xde, 0x0d, 0x03, 0x10,
+    0x30, 0x0c, 0x0d, 0x03, 0x10, 0x48, 0x50, 0x0d,
+    0x03, 0x10, 0x30, 0x50, 0x0d, 0x01, 0x20, 0x0f,
+    0x01, 0x20, 0x0f, 0x03, 0x20, 0x20, 0x20, 0x0d,
+    0x03, 0x20, 0x40, 0x10, 0x0d, 0x03, 0x20, 0x80,
+    0x08, 0x0d, 0x01, 0x11, 0x01, 0x01, 0x04, 0x5f,
+    0x01, 0x48, 0x0f, 0x01, 0xcf, 0x0e, 0x02, 0x01,
+    0x86, 0x0e, 0x02, 0x01, 0x80, 0x0e, 0x02, 0x01,
+    0x80, 0x0e, 0x02, 0x61, 0x8c, 0x0d, 0x03, 0x01,
+    0x09, 0xa1, 0x0d, 0x01, 0x02, 0x0f, 0x01, 0x04,
+    0x0f, 0x03, 0x04, 0xa0, 0x06, 0x0d, 0x03, 0x04,
+    0xa6, 0x6f, 0x0d, 0x03, 0x08, 0x18, 0x06, 0x0d,
+    0x03, 0x08, 0x24, 0x28, 0x0d, 0x03, 0x08, 0x18,
+    0x28, 0x0d, 0x01, 0x10, 0x0f, 0x01, 0x10, 0x0f,
+    0x03, 0x10, 0x10, 0x10, 0x0d, 0x03, 0x10, 0x20,
+    0x08, 0x0d, 0x03, 0x10, 0x40, 0x04, 0x0d, 0x03,
+    0x08, 0x80, 0x02, 0x5f, 0x01, 0x36, 0x0f, 0x01,
+    0x54, 0x0f, 0x01, 0xa2, 0x0f, 0x01, 0xa0, 0x0f,
+    0x01, 0xa0, 0x0e, 0x02, 0x28, 0xa5, 0x0e, 0x02,
+    0xc6, 0xb8, 0x0d, 0x02, 0x01, 0x80, 0x0e, 0x01,
+    0x03, 0x0f, 0x03, 0x03, 0x78, 0x02, 0x0d, 0x03,
+    0x03, 0x7a, 0xac, 0x0d, 0x03, 0x06, 0x0a, 0x02,
+    0x0d, 0x03, 0x06, 0x1b, 0x1e, 0x0d, 0x03, 0x06,
+    0x0a, 0x1e, 0x0d, 0x01, 0x0c, 0x0f, 0x01, 0x0c,
+    0x0f, 0x03, 0x0c, 0x0c, 0x0c, 0x0d, 0x03, 0x0c,
+    0x18, 0x06, 0x0d, 0x03, 0x0c, 0x30, 0x03, 0x0d,
+    0x03, 0x06, 0x60, 0x01, 0x5f, 0x01, 0x0d, 0x0f,
+    0x01, 0x15, 0x0f, 0x01, 0x28, 0x0f, 0x01, 0x28,
+    0x0f, 0x01, 0x28, 0x0e, 0x02, 0x0a, 0x29, 0x0e,
+    0x02, 0x31, 0xae, 0x0e, 0x01, 0x60, 0x0f, 0x01,
+    0xc0, 0x0f, 0x01, 0xde, 0x0f, 0x02, 0xde, 0xab,
+    0x0d, 0x03, 0x01, 0x82, 0x80, 0x0d, 0x03, 0x01,
+    0x86, 0xc7, 0x0d, 0x03, 0x01, 0x82, 0x87, 0x0d,
+    0x01, 0x03, 0x0f, 0x01, 0x03, 0x0f, 0x03, 0x03,
+    0x03, 0x03, 0x0d, 0x03, 0x03, 0x06, 0x01, 0x0d,
+    0x02, 0x03, 0x0c, 0x0e, 0x02, 0x01, 0x98, 0x5f,
+    0x01, 0x03, 0x0f, 0x01, 0x05, 0x0f, 0x01, 0x0a,
+    0x0f, 0x01, 0x0a, 0x0f, 0x01, 0x0a, 0x0e, 0x02,
+    0x02, 0x8a, 0x0e, 0x02, 0x0c, 0x6b, 0x0e, 0x01,
+    0x18, 0x0f, 0x01, 0x30, 0x0f, 0x02, 0x37, 0x80,
+    0x0e, 0x02, 0x37, 0xaa, 0x0e, 0x02, 0x60, 0xa0,
+    0x0e, 0x02, 0x61, 0xb1, 0x0e, 0x02, 0x60, 0xa1,
+    0x0e, 0x01, 0xc0, 0x0f, 0x01, 0xc0, 0x0f, 0x02,
+    0xc0, 0xc0, 0x0e, 0x02, 0xc1, 0x80, 0x0e, 0x01,
+    0xc3, 0x0f, 0x01, 0x66, 0x6f, 0x01, 0x01, 0x0f,
+    0x01, 0x02, 0x0f, 0x01, 0x02, 0x0f, 0x01, 0x02,
+    0x0f, 0x01, 0xa2, 0x0e, 0x02, 0x03, 0x1a, 0x0e,
+    0x01, 0x06, 0x0f, 0x01, 0x0c, 0x0f, 0x02, 0x0d,
+    0xe0, 0x0e, 0x02, 0x0d, 0xea, 0x0e, 0x02, 0x18,
+    0x28, 0x0e, 0x02, 0x18, 0x6c, 0x0e, 0x02, 0x18,
+    0x28, 0x0e, 0x01, 0x30, 0x0f, 0x01, 0x30, 0x0f,
+    0x02, 0x30, 0x30, 0x0e, 0x02, 0x30, 0x60, 0x0e,
+    0x02, 0x30, 0xc0, 0x0e, 0x02, 0x19, 0x80, 0xaf,
+    0x01, 0x24, 0x0f, 0x01, 0xe7, 0x0e, 0x02, 0x01,
+    0xc0, 0x0e, 0x02, 0x03, 0x80, 0x0e, 0x02, 0x03,
+    0xec, 0x0e, 0x02, 0x03, 0xee, 0x0e, 0x02, 0x07,
+    0x09, 0x0e, 0x02, 0x07, 0x1f, 0x0e, 0x02, 0x07,
+    0x09, 0x0e, 0x01, 0x0e, 0x0f, 0x01, 0x0e, 0x0f,
+    0x02, 0x0e, 0x0e, 0x0e, 0x02, 0x0e, 0x1c, 0x0e,
+    0x02, 0x0e, 0x38, 0x0e, 0x02, 0x07, 0x70, 0xaf,
+    0x01, 0x04, 0x0f, 0x01, 0x1f, 0x0f, 0x01, 0x3e,
+    0x0f, 0x01, 0x7c, 0x0f, 0x01, 0x70, 0x0f, 0x01,
+    0x70, 0x0f, 0x01, 0xf9, 0x0f, 0x01, 0xfb, 0x0f,
+    0x01, 0xf9, 0x0e, 0x02, 0x01, 0xf0, 0x0e, 0x02,
+    0x01, 0xf0, 0x0e, 0x02, 0x01, 0xf1, 0x0e, 0x02,
+    0x01, 0xf3, 0x0e, 0x02, 0x01, 0xf7, 0x0f, 0x01,
+    0xf7, 0xcf, 0x01, 0x01, 0x0f, 0x01, 0x03, 0x0f,
+    0x01, 0x03, 0x0f, 0x01, 0x03, 0x0f, 0x01, 0x07,
+    0x0f, 0x01, 0x07, 0x0f, 0x01, 0x07, 0x0f, 0x01,
+    0x0f, 0x0f, 0x01, 0x0f, 0x0f, 0x01, 0x0f, 0x0f,
+    0x01, 0x0f, 0x0f, 0x01, 0x0f, 0x0f, 0x01, 0x07
+};
+
+static const ElementDeltas element_deltas_layer_symbol_symbol_controller = {
+    .resource = &resource_symbol_controller,
+    .steps = {
+        { {  96,  5,  32, 20 },  105, element_deltas_layer_symbol_symbol_controller_runs + 0 },
+        { {   0,  0,   0,  0 },    0, element_deltas_layer_symbol_symbol_controller_runs + 105 },
+        { {  96,  5,  32, 20 },  107, element_deltas_layer_symbol_symbol_controller_runs + 105 },
+        { {  96,  5,  32, 20 },  104, element_deltas_layer_symbol_symbol_controller_runs + 212 },
+        { { 104,  5,  24, 20 },   95, element_deltas_layer_symbol_symbol_controller_runs + 316 },
+        { { 104,  5,  24, 20 },   93, element_deltas_layer_symbol_symbol_controller_runs + 411 },
+        { { 104,  5,  24, 20 },   87, element_deltas_layer_symbol_symbol_controller_runs + 504 },
+        { { 104,  5,  24, 20 },   84, element_deltas_layer_symbol_symbol_controller_runs + 591 },
+        { { 104,  5,  24, 20 },   81, element_deltas_layer_symbol_symbol_controller_runs + 675 },
+        { { 104,  5,  24, 20 },   75, element_deltas_layer_symbol_symbol_controller_runs + 756 },
+        { { 112,  5,  16, 20 },   69, element_deltas_layer_symbol_symbol_controller_runs + 831 },
+        { { 112,  6,  16, 19 },   67, element_deltas_layer_symbol_symbol_controller_runs + 900 },
+        { { 112, 10,  16, 15 },   56, element_deltas_layer_symbol_symbol_controller_runs + 967 },
+        { { 112, 10,  16, 15 },   50, element_deltas_layer_symbol_symbol_controller_runs + 1023 },
+        { { 120, 12,   8, 13 },   39, element_deltas_layer_symbol_symbol_controller_runs + 1073 }
+    },
+    .appear = { {   0,  0,   0,  0 },    0, element_deltas_layer_symbol_symbol_controller_runs + 1112 }
+};
+
+// LOGO showing resource_logo_cod
+static const uint8_t element_deltas_logo_logo_cod_runs[861] = {
+    0xa0, 0x02, 0x88, 0x09, 0x01, 0x01, 0x48, 0x0c,
+    0x04, 0x8c, 0x19, 0x94, 0xcc, 0x0c, 0x04, 0x86,
+    0x31, 0xb6, 0xcc, 0x0c, 0x04, 0x83, 0x61, 0xe3,
+    0xcc, 0x0c, 0x04, 0x82, 0x41, 0x21, 0x4c, 0x0c,
+    0x04, 0x81, 0x4e, 0x40, 0xcc, 0x0c, 0x04, 0x98,
+    0x13, 0x8c, 0x0c, 0x0c, 0x04, 0x94, 0x24, 0x12,
+    0x0c, 0x0c, 0x04, 0x92, 0x3c, 0x35, 0x0c, 0x0c,
+    0x04, 0x9b, 0x6c, 0x63, 0x0c, 0x0c, 0x04, 0x9a,
+    0x4c, 0xc1, 0x8c, 0x0c, 0x04, 0x89, 0x84, 0x40,
+    0x88, 0xa0, 0x02, 0x10, 0x12, 0x01, 0x01, 0x90,
+    0x0c, 0x04, 0x18, 0x33, 0x29, 0x98, 0x0c, 0x04,
+    0x0c, 0x63, 0x6d, 0x98, 0x0c, 0x04, 0x06, 0xc3,
+    0xc7, 0x98, 0x0c, 0x04, 0x04, 0x82, 0x42, 0x98,
+    0x0c, 0x04, 0x02, 0x9c, 0x81, 0x98, 0x0c, 0x04,
+    0x30, 0x27, 0x18, 0x18, 0x0c, 0x04, 0x28, 0x48,
+    0x24, 0x18, 0x0c, 0x04, 0x24, 0x78, 0x6a, 0x18,
+    0x0c, 0x04, 0x36, 0xd8, 0xc6, 0x18, 0x0c, 0x04,
+    0x34, 0x99, 0x83, 0x18, 0x0c, 0x04, 0x13, 0x08,
+    0x81, 0x10, 0xa0, 0x04, 0x20, 0x24, 0x01, 0x20,
+    0x0c, 0x04, 0x30, 0x66, 0x53, 0x30, 0x0c, 0x04,
+    0x18, 0xc6, 0xdb, 0x30, 0x0c, 0x04, 0x0d, 0x87,
+    0x8f, 0x30, 0x0c, 0x04, 0x09, 0x04, 0x85, 0x30,
+    0x0c, 0x04, 0x05, 0x39, 0x03, 0x30, 0x0c, 0x04,
+    0x60, 0x4e, 0x30, 0x30, 0x0c, 0x04, 0x50, 0x90,
+    0x48, 0x30, 0x0c, 0x04, 0x48, 0xf0, 0xd4, 0x30,
+    0x0c, 0x04, 0x6d, 0xb1, 0x8c, 0x30, 0x0c, 0x04,
+    0x69, 0x33, 0x06, 0x30, 0x0c, 0x04, 0x26, 0x11,
+    0x02, 0x20, 0xa0, 0x04, 0x40, 0x48, 0x02, 0x40,
+    0x0c, 0x04, 0x60, 0xcc, 0xa6, 0x60, 0x0c, 0x04,
+    0x31, 0x8d, 0xb6, 0x60, 0x0c, 0x04, 0x1b, 0x0f,
+    0x1e, 0x60, 0x0c, 0x04, 0x12, 0x09, 0x0a, 0x60,
+    0x0c, 0x04, 0x0a, 0x72, 0x06, 0x60, 0x0c, 0x04,
+    0xc0, 0x9c, 0x60, 0x60, 0x0c, 0x04, 0xa1, 0x20,
+    0x90, 0x60, 0x0c, 0x04, 0x91, 0xe1, 0xa8, 0x60,
+    0x0c, 0x04, 0xdb, 0x63, 0x18, 0x60, 0x0c, 0x04,
+    0xd2, 0x66, 0x0c, 0x60, 0x0c, 0x04, 0x4c, 0x22,
+    0x04, 0x40, 0xa0, 0x04, 0x80, 0x90, 0x04, 0x80,
+    0x0c, 0x04, 0xc1, 0x99, 0x4c, 0xc0, 0x0c, 0x04,
+    0x63, 0x1b, 0x6c, 0xc0, 0x0c, 0x04, 0x36, 0x1e,
+    0x3c, 0xc0, 0x0c, 0x04, 0x24, 0x12, 0x14, 0xc0,
+    0x0c, 0x04, 0x14, 0xe4, 0x0c, 0xc0, 0x0c, 0x04,
+    0x81, 0x38, 0xc0, 0xc0, 0x0c, 0x04, 0x42, 0x41,
+    0x20, 0xc0, 0x0c, 0x04, 0x23, 0xc3, 0x50, 0xc0,
+    0x0c, 0x04, 0xb6, 0xc6, 0x30, 0xc0, 0x0c, 0x04,
+    0xa4, 0xcc, 0x18, 0xc0, 0x0c, 0x04, 0x98, 0x44,
+    0x08, 0x80, 0xa0, 0x03, 0x01, 0x20, 0x09, 0x0d,
+    0x04, 0x83, 0x32, 0x99, 0x80, 0x0c, 0x04, 0xc6,
+    0x36, 0xd9, 0x80, 0x0c, 0x04, 0x6c, 0x3c, 0x79,
+    0x80, 0x0c, 0x04, 0x48, 0x24, 0x29, 0x80, 0x0c,
+    0x04, 0x29, 0xc8, 0x19, 0x80, 0x0c, 0x04, 0x02,
+    0x71, 0x81, 0x80, 0x0c, 0x04, 0x84, 0x82, 0x41,
+    0x80, 0x0c, 0x04, 0x47, 0x86, 0xa1, 0x80, 0x0c,
+    0x04, 0x6d, 0x8c, 0x61, 0x80, 0x0c, 0x04, 0x49,
+    0x98, 0x31, 0x80, 0x0c, 0x03, 0x30, 0x88, 0x11,
+    0xa0, 0x03, 0x02, 0x40, 0x12, 0x0d, 0x03, 0x06,
+    0x65, 0x33, 0x0d, 0x03, 0x8c, 0x6d, 0xb3, 0x0d,
+    0x03, 0xd8, 0x78, 0xf3, 0x0d, 0x03, 0x90, 0x48,
+    0x53, 0x0d, 0x03, 0x53, 0x90, 0x33, 0x0d, 0x03,
+    0x04, 0xe3, 0x03, 0x0d, 0x03, 0x09, 0x04, 0x83,
+    0x0d, 0x03, 0x8f, 0x0d, 0x43, 0x0d, 0x03, 0xdb,
+    0x18, 0xc3, 0x0d, 0x03, 0x93, 0x30, 0x63, 0x0d,
+    0x03, 0x61, 0x10, 0x22, 0xa0, 0x03, 0x0d, 0x80,
+    0x6c, 0x0d, 0x03, 0x15, 0x5e, 0xaa, 0x0d, 0x03,
+    0x29, 0x6d, 0xaa, 0x0d, 0x03, 0xd1, 0x12, 0x2a,
+    0x0d, 0x03, 0x61, 0xb1, 0xea, 0x0d, 0x03, 0xe9,
+    0x60, 0xaa, 0x0d, 0x03, 0x1a, 0x4a, 0x0a, 0x0d,
+    0x03, 0x36, 0x1b, 0x0a, 0x0d, 0x03, 0x22, 0x2f,
+    0x8a, 0x0d, 0x03, 0xda, 0x52, 0x8a, 0x0d, 0x03,
+    0x6a, 0xa1, 0x4a, 0x0d, 0x03, 0x46, 0x60, 0xcc,
+    0xa0, 0x03, 0x36, 0x01, 0xb0, 0x0d, 0x03, 0x55,
+    0x7a, 0xa8, 0x0d, 0x03, 0xa5, 0xb6, 0xa8, 0x0d,
+    0x03, 0x44, 0x48, 0xa8, 0x0d, 0x03, 0x86, 0xc7,
+    0xa8, 0x0d, 0x03, 0xa5, 0x82, 0xa8, 0x0d, 0x03,
+    0x69, 0x28, 0x28, 0x0d, 0x03, 0xd8, 0x6c, 0x28,
+    0x0d, 0x03, 0x88, 0xbe, 0x28, 0x0d, 0x03, 0x69,
+    0x4a, 0x28, 0x0d, 0x03, 0xaa, 0x85, 0x28, 0x0d,
+    0x03, 0x19, 0x83, 0x30, 0xa0, 0x03, 0xd8, 0x06,
+    0xc0, 0x0d, 0x03, 0x55, 0xea, 0xa0, 0x0d, 0x03,
+    0x96, 0xda, 0xa0, 0x0d, 0x03, 0x11, 0x22, 0xa0,
+    0x0d, 0x03, 0x1b, 0x1e, 0xa0, 0x0d, 0x03, 0x96,
+    0x0a, 0xa0, 0x0d, 0x03, 0xa4, 0xa0, 0xa0, 0x0d,
+    0x03, 0x61, 0xb0, 0xa0, 0x0d, 0x03, 0x22, 0xf8,
+    0xa0, 0x0d, 0x03, 0xa5, 0x28, 0xa0, 0x0d, 0x03,
+    0xaa, 0x14, 0xa0, 0x0d, 0x03, 0x66, 0x0c, 0xc0,
+    0xa0, 0x02, 0x60, 0x1b, 0x0e, 0x03, 0x57, 0xaa,
+    0x80, 0x0d, 0x03, 0x5b, 0x6a, 0x80, 0x0d, 0x03,
+    0x44, 0x8a, 0x80, 0x0d, 0x03, 0x6c, 0x7a, 0x80,
+    0x0d, 0x03, 0x58, 0x2a, 0x80, 0x0d, 0x03, 0x92,
+    0x82, 0x80, 0x0d, 0x03, 0x86, 0xc2, 0x80, 0x0d,
+    0x03, 0x8b, 0xe2, 0x80, 0x0d, 0x03, 0x94, 0xa2,
+    0x80, 0x0d, 0x03, 0xa8, 0x52, 0x80, 0x0d, 0x02,
+    0x98, 0x33, 0xa0, 0x02, 0x80, 0xfc, 0x0e, 0x02,
+    0x77, 0x32, 0x0f, 0x01, 0x32, 0x0e, 0x02, 0xd5,
+    0xb2, 0x0e, 0x02, 0xf3, 0x72, 0x0e, 0x02, 0xe1,
+    0x32, 0x0e, 0x02, 0x52, 0x12, 0x0e, 0x02, 0x3f,
+    0x12, 0x0e, 0x02, 0x45, 0x92, 0x0e, 0x02, 0x94,
+    0x92, 0x0e, 0x02, 0x22, 0x52, 0x0e, 0x02, 0xe1,
+    0xdc, 0xa0, 0x02, 0x1c, 0xe0, 0x0e, 0x02, 0x13,
+    0x10, 0x0e, 0x02, 0x6b, 0x10, 0x0e, 0x02, 0x27,
+    0x10, 0x0e, 0x02, 0xe1, 0x10, 0x0e, 0x02, 0x23,
+    0x10, 0x0e, 0x02, 0x12, 0x10, 0x0e, 0x02, 0x3a,
+    0x10, 0x0e, 0x02, 0xce, 0x10, 0x0e, 0x02, 0x06,
+    0x10, 0x0e, 0x02, 0x40, 0x10, 0x0e, 0x02, 0x3d,
+    0xe0, 0xa0, 0x01, 0x1c, 0x0f, 0x01, 0x22, 0x0f,
+    0x01, 0x22, 0x0f, 0x01, 0xa2, 0x0f, 0x01, 0x62,
+    0x0f, 0x01, 0x22, 0x0f, 0x01, 0x02, 0x0f, 0x01,
+    0x02, 0x0f, 0x01, 0x82, 0x0f, 0x01, 0x82, 0x0f,
+    0x01, 0x42, 0x0f, 0x01, 0x3c
+};
+
+static const ElementDeltas element_deltas_logo_logo_cod = {
+    .resource = &resource_logo_cod,
+    .steps = {
+        { {   0, 10,  32, 12 },   73, element_deltas_logo_logo_cod_runs + 0 },
+        { {   0,  0,   0,  0 },    0, element_deltas_logo_logo_cod_runs + 73 },
+        { {   0, 10,  32, 12 },   73, element_deltas_logo_logo_cod_runs + 73 },
+        { {   0, 10,  32, 12 },   72, element_deltas_logo_logo_cod_runs + 146 },
+        { {   0, 10,  32, 12 },   72, element_deltas_logo_logo_cod_runs + 218 },
+        { {   0, 10,  32, 12 },   72, element_deltas_logo_logo_cod_runs + 290 },
+        { {   0, 10,  32, 12 },   70, element_deltas_logo_logo_cod_runs + 362 },
+        { {   0, 10,  24, 12 },   60, element_deltas_logo_logo_cod_runs + 432 },
+        { {   0, 10,  24, 12 },   60, element_deltas_logo_logo_cod_runs + 492 },
+        { {   0, 10,  24, 12 },   60, element_deltas_logo_logo_cod_runs + 552 },
+        { {   0, 10,  24, 12 },   60, element_deltas_logo_logo_cod_runs + 612 },
+        { {   0, 10,  24, 12 },   58, element_deltas_logo_logo_cod_runs + 672 },
+        { {   0, 10,  16, 12 },   47, element_deltas_logo_logo_cod_runs + 730 },
+        { {   0, 10,  16, 12 },   48, element_deltas_logo_logo_cod_runs + 777 },
+        { {   0, 10,   8, 12 },   36, element_deltas_logo_logo_cod_runs + 825 }
+    },
+    .appear = { {   0,  0,   0,  0 },    0, element_deltas_logo_logo_cod_runs + 861 }
+};
+
+// NAME showing resource_name_cod
+static const uint8_t element_deltas_name_name_cod_runs[547] = {
+    0x24, 0x01, 0xe7, 0x01, 0x01, 0x02, 0x1d, 0x06,
+    0x10, 0x3c, 0x38, 0x3c, 0x6e, 0x6c, 0x0a, 0x06,
+    0x20, 0x42, 0x44, 0x42, 0x10, 0x12, 0x0a, 0x06,
+    0x0c, 0x1c, 0x18, 0x1c, 0x1d, 0x18, 0x0a, 0x01,
+    0x10, 0x01, 0x04, 0x04, 0x1c, 0x01, 0x04, 0x0a,
+    0x01, 0x08, 0x03, 0x01, 0x02, 0x0d, 0x02, 0x04,
+    0x1e, 0x0d, 0x03, 0x1c, 0x18, 0x1e, 0x0d, 0x03,
+    0x42, 0x44, 0x42, 0x0c, 0x06, 0xc3, 0x3c, 0x3a,
+    0x3c, 0x60, 0x62, 0x14, 0x01, 0xe7, 0x01, 0x01,
+    0x02, 0x1d, 0x06, 0x10, 0x3c, 0x38, 0x3c, 0x6e,
+    0x6c, 0x0a, 0x06, 0x20, 0x42, 0x44, 0x42, 0x10,
+    0x12, 0x0a, 0x06, 0x0c, 0x1c, 0x18, 0x1c, 0x1d,
+    0x18, 0x0a, 0x01, 0x10, 0x01, 0x04, 0x04, 0x1c,
+    0x01, 0x04, 0x0a, 0x01, 0x08, 0x03, 0x01, 0x02,
+    0x0d, 0x02, 0x04, 0x1e, 0x0d, 0x03, 0x1c, 0x18,
+    0x1e, 0x0d, 0x03, 0x42, 0x44, 0x42, 0x0c, 0x06,
+    0xc3, 0x3c, 0x3a, 0x3c, 0x60, 0x62, 0x04, 0x01,
+    0xe7, 0x01, 0x01, 0x02, 0x1d, 0x06, 0x10, 0x3c,
+    0x38, 0x3c, 0x6e, 0x6c, 0x0a, 0x06, 0x20, 0x42,
+    0x44, 0x42, 0x10, 0x12, 0x0a, 0x06, 0x0c, 0x1c,
+    0x18, 0x1c, 0x1d, 0x18, 0x0a, 0x01, 0x10, 0x01,
+    0x04, 0x04, 0x1c, 0x01, 0x04, 0x0a, 0x01, 0x08,
+    0x03, 0x01, 0x02, 0x0d, 0x02, 0x04, 0x1e, 0x0d,
+    0x03, 0x1c, 0x18, 0x1e, 0x0d, 0x03, 0x42, 0x44,
+    0x42, 0x0c, 0x06, 0xc3, 0x3c, 0x3a, 0x3c, 0x60,
+    0x62, 0x14, 0x06, 0x10, 0x3c, 0x38, 0x3c, 0x6e,
+    0x6c, 0x0a, 0x06, 0x20, 0x42, 0x44, 0x42, 0x10,
+    0x12, 0x0a, 0x06, 0x0c, 0x1c, 0x18, 0x1c, 0x1d,
+    0x18, 0x0a, 0x01, 0x10, 0x01, 0x04, 0x04, 0x1c,
+    0x01, 0x04, 0x0a, 0x01, 0x08, 0x03, 0x01, 0x02,
+    0x0d, 0x02, 0x04, 0x1e, 0x0d, 0x03, 0x1c, 0x18,
+    0x1e, 0x0d, 0x03, 0x42, 0x44, 0x42, 0x0c, 0x06,
+    0xc3, 0x3c, 0x3a, 0x3c, 0x60, 0x62, 0x04, 0x06,
+    0x10, 0x3c, 0x38, 0x3c, 0x6e, 0x6c, 0x0a, 0x06,
+    0x20, 0x42, 0x44, 0x42, 0x10, 0x12, 0x0a, 0x06,
+    0x0c, 0x1c, 0x18, 0x1c, 0x1d, 0x18, 0x0a, 0x01,
+    0x10, 0x01, 0x04, 0x04, 0x1c, 0x01, 0x04, 0x0a,
+    0x01, 0x08, 0x03, 0x01, 0x02, 0x0d, 0x02, 0x04,
+    0x1e, 0x0d, 0x03, 0x1c, 0x18, 0x1e, 0x0d, 0x03,
+    0x42, 0x44, 0x42, 0x0c, 0x06, 0xc3, 0x3c, 0x3a,
+    0x3c, 0x60, 0x62, 0x04, 0x06, 0x20, 0x42, 0x44,
+    0x42, 0x10, 0x12, 0x0a, 0x06, 0x0c, 0x1c, 0x18,
+    0x1c, 0x1d, 0x18, 0x0a, 0x01, 0x10, 0x01, 0x04,
+    0x04, 0x1c, 0x01, 0x04, 0x0a, 0x01, 0x08, 0x03,
+    0x01, 0x02, 0x0d, 0x02, 0x04, 0x1e, 0x0d, 0x03,
+    0x1c, 0x18, 0x1e, 0x0d, 0x03, 0x42, 0x44, 0x42,
+    0x0c, 0x06, 0xc3, 0x3c, 0x3a, 0x3c, 0x60, 0x62,
+    0x04, 0x06, 0x0c, 0x1c, 0x18, 0x1c, 0x1d, 0x18,
+    0x0a, 0x01, 0x10, 0x01, 0x04, 0x04, 0x1c, 0x01,
+    0x04, 0x0a, 0x01, 0x08, 0x03, 0x01, 0x02, 0x0d,
+    0x02, 0x04, 0x1e, 0x0d, 0x03, 0x1c, 0x18, 0x1e,
+    0x0d, 0x03, 0x42, 0x44, 0x42, 0x0c, 0x06, 0xc3,
+    0x3c, 0x3a, 0x3c, 0x60, 0x62, 0x04, 0x01, 0x10,
+    0x01, 0x04, 0x04, 0x1c, 0x01, 0x04, 0x0a, 0x01,
+    0x08, 0x03, 0x01, 0x02, 0x0d, 0x02, 0x04, 0x1e,
+    0x0d, 0x03, 0x1c, 0x18, 0x1e, 0x0d, 0x03, 0x42,
+    0x44, 0x42, 0x0c, 0x06, 0xc3, 0x3c, 0x3a, 0x3c,
+    0x60, 0x62, 0x04, 0x01, 0x08, 0x03, 0x01, 0x02,
+    0x0d, 0x02, 0x04, 0x1e, 0x0d, 0x03, 0x1c, 0x18,
+    0x1e, 0x0d, 0x03, 0x42, 0x44, 0x42, 0x0c, 0x06,
+    0xc3, 0x3c, 0x3a, 0x3c, 0x60, 0x62, 0x06, 0x02,
+    0x04, 0x1e, 0x0d, 0x03, 0x1c, 0x18, 0x1e, 0x0d,
+    0x03, 0x42, 0x44, 0x42, 0x0c, 0x06, 0xc3, 0x3c,
+    0x3a, 0x3c, 0x60, 0x62, 0x05, 0x03, 0x1c, 0x18,
+    0x1e, 0x0d, 0x03, 0x42, 0x44, 0x42, 0x0c, 0x06,
+    0xc3, 0x3c, 0x3a, 0x3c, 0x60, 0x62, 0x05, 0x03,
+    0x42, 0x44, 0x42, 0x0c, 0x06, 0xc3, 0x3c, 0x3a,
+    0x3c, 0x60, 0x62, 0x04, 0x06, 0xc3, 0x3c, 0x3a,
+    0x3c, 0x60, 0x62
+};
+
+static const ElementDeltas element_deltas_name_name_cod = {
+    .resource = &resource_name_cod,
+    .steps = {
+        { {  32,  2,  48, 11 },   67, element_deltas_name_name_cod_runs + 0 },
+        { {  32,  1,  48, 11 },   67, element_deltas_name_name_cod_runs + 67 },
+        { {  32,  0,  48, 11 },   67, element_deltas_name_name_cod_runs + 134 },
+        { {  32,  1,  48,  9 },   61, element_deltas_name_name_cod_runs + 201 },
+        { {  32,  0,  48,  9 },   61, element_deltas_name_name_cod_runs + 262 },
+        { {  32,  0,  48,  8 },   53, element_deltas_name_name_cod_runs + 323 },
+        { {  32,  0,  48,  7 },   45, element_deltas_name_name_cod_runs + 376 },
+        { {  32,  0,  48,  6 },   37, element_deltas_name_name_cod_runs + 421 },
+        { {  32,  0,  48,  5 },   28, element_deltas_name_name_cod_runs + 458 },
+        { {  32,  0,  48,  4 },   22, element_deltas_name_name_cod_runs + 486 },
+        { {  32,  0,  48,  3 },   18, element_deltas_name_name_cod_runs + 508 },
+        { {  32,  0,  48,  2 },   13, element_deltas_name_name_cod_runs + 526 },
+        { {  32,  0,  48,  1 },    8, element_deltas_name_name_cod_runs + 539 },
+        { {   0,  0,   0,  0 },    0, element_deltas_name_name_cod_runs + 547 },
+        { {   0,  0,   0,  0 },    0, element_deltas_name_name_cod_runs + 547 }
+    },
+    .appear = { {   0,  0,   0,  0 },    0, element_deltas_name_name_cod_runs + 547 }
+};
+
+// MODE showing resource_mode_cod
+static const uint8_t element_deltas_mode_mode_cod_runs[814] = {
+    0xff, 0x00, 0x25, 0x01, 0xd9, 0x02, 0x01, 0x0f,
+    0x0f, 0x01, 0x11, 0x0c, 0x07, 0x02, 0x3c, 0x6e,
+    0x61, 0x3c, 0x6e, 0x3c, 0x09, 0x07, 0x80, 0x42,
+    0x10, 0x01, 0x42, 0x10, 0x42, 0x09, 0x07, 0x08,
+    0x7c, 0x1d, 0x66, 0x7c, 0x1d, 0x1c, 0x09, 0x03,
+    0x04, 0x3c, 0x01, 0x01, 0x03, 0x3c, 0x01, 0x1c,
+    0x09, 0x03, 0x21, 0x40, 0x02, 0x01, 0x02, 0x40,
+    0x02, 0x0b, 0x01, 0x1c, 0x02, 0x01, 0x1c, 0x01,
+    0x01, 0x1e, 0x09, 0x02, 0x10, 0x1c, 0x02, 0x01,
+    0x1c, 0x01, 0x01, 0x1e, 0x0a, 0x01, 0x44, 0x02,
+    0x01, 0x44, 0x01, 0x01, 0x42, 0x09, 0x07, 0x66,
+    0x3a, 0x60, 0x18, 0x3a, 0x60, 0x3c, 0xff, 0x00,
+    0x35, 0x01, 0xd9, 0x02, 0x01, 0x0f, 0x0f, 0x01,
+    0x11, 0x0c, 0x07, 0x02, 0x3c, 0x6e, 0x61, 0x3c,
+    0x6e, 0x3c, 0x09, 0x07, 0x80, 0x42, 0x10, 0x01,
+    0x42, 0x10, 0x42, 0x09, 0x07, 0x08, 0x7c, 0x1d,
+    0x66, 0x7c, 0x1d, 0x1c, 0x09, 0x03, 0x04, 0x3c,
+    0x01, 0x01, 0x03, 0x3c, 0x01, 0x1c, 0x09, 0x03,
+    0x21, 0x40, 0x02, 0x01, 0x02, 0x40, 0x02, 0x0b,
+    0x01, 0x1c, 0x02, 0x01, 0x1c, 0x01, 0x01, 0x1e,
+    0x09, 0x02, 0x10, 0x1c, 0x02, 0x01, 0x1c, 0x01,
+    0x01, 0x1e, 0x0a, 0x01, 0x44, 0x02, 0x01, 0x44,
+    0x01, 0x01, 0x42, 0x09, 0x07, 0x66, 0x3a, 0x60,
+    0x18, 0x3a, 0x60, 0x3c, 0xff, 0x00, 0x45, 0x01,
+    0xd9, 0x02, 0x01, 0x0f, 0x0f, 0x01, 0x11, 0x0c,
+    0x07, 0x02, 0x3c, 0x6e, 0x61, 0x3c, 0x6e, 0x3c,
+    0x09, 0x07, 0x80, 0x42, 0x10, 0x01, 0x42, 0x10,
+    0x42, 0x09, 0x07, 0x08, 0x7c, 0x1d, 0x66, 0x7c,
+    0x1d, 0x1c, 0x09, 0x03, 0x04, 0x3c, 0x01, 0x01,
+    0x03, 0x3c, 0x01, 0x1c, 0x09, 0x03, 0x21, 0x40,
+    0x02, 0x01, 0x02, 0x40, 0x02, 0x0b, 0x01, 0x1c,
+    0x02, 0x01, 0x1c, 0x01, 0x01, 0x1e, 0x09, 0x02,
+    0x10, 0x1c, 0x02, 0x01, 0x1c, 0x01, 0x01, 0x1e,
+    0x0a, 0x01, 0x44, 0x02, 0x01, 0x44, 0x01, 0x01,
+    0x42, 0x09, 0x07, 0x66, 0x3a, 0x60, 0x18, 0x3a,
+    0x60, 0x3c, 0xff, 0x00, 0x55, 0x01, 0xd9, 0x02,
+    0x01, 0x0f, 0x0f, 0x01, 0x11, 0x0c, 0x07, 0x02,
+    0x3c, 0x6e, 0x61, 0x3c, 0x6e, 0x3c, 0x09, 0x07,
+    0x80, 0x42, 0x10, 0x01, 0x42, 0x10, 0x42, 0x09,
+    0x07, 0x08, 0x7c, 0x1d, 0x66, 0x7c, 0x1d, 0x1c,
+    0x09, 0x03, 0x04, 0x3c, 0x01, 0x01, 0x03, 0x3c,
+    0x01, 0x1c, 0x09, 0x03, 0x21, 0x40, 0x02, 0x01,
+    0x02, 0x40, 0x02, 0x0b, 0x01, 0x1c, 0x02, 0x01,
+    0x1c, 0x01, 0x01, 0x1e, 0x09, 0x02, 0x10, 0x1c,
+    0x02, 0x01, 0x1c, 0x01, 0x01, 0x1e, 0x0a, 0x01,
+    0x44, 0x02, 0x01, 0x44, 0x01, 0x01, 0x42, 0x09,
+    0x07, 0x66, 0x3a, 0x60, 0x18, 0x3a, 0x60, 0x3c,
+    0xff, 0x00, 0x65, 0x01, 0xd9, 0x02, 0x01, 0x0f,
+    0x0f, 0x01, 0x11, 0x0c, 0x07, 0x02, 0x3c, 0x6e,
+    0x61, 0x3c, 0x6e, 0x3c, 0x09, 0x07, 0x80, 0x42,
+    0x10, 0x01, 0x42, 0x10, 0x42, 0x09, 0x07, 0x08,
+    0x7c, 0x1d, 0x66, 0x7c, 0x1d, 0x1c, 0x09, 0x03,
+    0x04, 0x3c, 0x01, 0x01, 0x03, 0x3c, 0x01, 0x1c,
+    0x09, 0x03, 0x21, 0x40, 0x02, 0x01, 0x02, 0x40,
+    0x02, 0x0b, 0x01, 0x1c, 0x02, 0x01, 0x1c, 0x01,
+    0x01, 0x1e, 0x09, 0x02, 0x10, 0x1c, 0x02, 0x01,
+    0x1c, 0x01, 0x01, 0x1e, 0x0a, 0x01, 0x44, 0x02,
+    0x01, 0x44, 0x01, 0x01, 0x42, 0xff, 0x00, 0x75,
+    0x01, 0xd9, 0x02, 0x01, 0x0f, 0x0f, 0x01, 0x11,
+    0x0c, 0x07, 0x02, 0x3c, 0x6e, 0x61, 0x3c, 0x6e,
+    0x3c, 0x09, 0x07, 0x80, 0x42, 0x10, 0x01, 0x42,
+    0x10, 0x42, 0x09, 0x07, 0x08, 0x7c, 0x1d, 0x66,
+    0x7c, 0x1d, 0x1c, 0x09, 0x03, 0x04, 0x3c, 0x01,
+    0x01, 0x03, 0x3c, 0x01, 0x1c, 0x09, 0x03, 0x21,
+    0x40, 0x02, 0x01, 0x02, 0x40, 0x02, 0x0b, 0x01,
+    0x1c, 0x02, 0x01, 0x1c, 0x01, 0x01, 0x1e, 0x09,
+    0x02, 0x10, 0x1c, 0x02, 0x01, 0x1c, 0x01, 0x01,
+    0x1e, 0xff, 0x00, 0x85, 0x01, 0xd9, 0x02, 0x01,
+    0x0f, 0x0f, 0x01, 0x11, 0x0c, 0x07, 0x02, 0x3c,
+    0x6e, 0x61, 0x3c, 0x6e, 0x3c, 0x09, 0x07, 0x80,
+    0x42, 0x10, 0x01, 0x42, 0x10, 0x42, 0x09, 0x07,
+    0x08, 0x7c, 0x1d, 0x66, 0x7c, 0x1d, 0x1c, 0x09,
+    0x03, 0x04, 0x3c, 0x01, 0x01, 0x03, 0x3c, 0x01,
+    0x1c, 0x09, 0x03, 0x21, 0x40, 0x02, 0x01, 0x02,
+    0x40, 0x02, 0x0b, 0x01, 0x1c, 0x02, 0x01, 0x1c,
+    0x01, 0x01, 0x1e, 0xff, 0x00, 0x95, 0x01, 0xd9,
+    0x02, 0x01, 0x0f, 0x0f, 0x01, 0x11, 0x0c, 0x07,
+    0x02, 0x3c, 0x6e, 0x61, 0x3c, 0x6e, 0x3c, 0x09,
+    0x07, 0x80, 0x42, 0x10, 0x01, 0x42, 0x10, 0x42,
+    0x09, 0x07, 0x08, 0x7c, 0x1d, 0x66, 0x7c, 0x1d,
+    0x1c, 0x09, 0x03, 0x04, 0x3c, 0x01, 0x01, 0x03,
+    0x3c, 0x01, 0x1c, 0x09, 0x03, 0x21, 0x40, 0x02,
+    0x01, 0x02, 0x40, 0x02, 0xff, 0x00, 0xa5, 0x01,
+    0xd9, 0x02, 0x01, 0x0f, 0x0f, 0x01, 0x11, 0x0c,
+    0x07, 0x02, 0x3c, 0x6e, 0x61, 0x3c, 0x6e, 0x3c,
+    0x09, 0x07, 0x80, 0x42, 0x10, 0x01, 0x42, 0x10,
+    0x42, 0x09, 0x07, 0x08, 0x7c, 0x1d, 0x66, 0x7c,
+    0x1d, 0x1c, 0x09, 0x03, 0x04, 0x3c, 0x01, 0x01,
+    0x03, 0x3c, 0x01, 0x1c, 0xff, 0x00, 0xb5, 0x01,
+    0xd9, 0x02, 0x01, 0x0f, 0x0f, 0x01, 0x11, 0x0c,
+    0x07, 0x02, 0x3c, 0x6e, 0x61, 0x3c, 0x6e, 0x3c,
+    0x09, 0x07, 0x80, 0x42, 0x10, 0x01, 0x42, 0x10,
+    0x42, 0x09, 0x07, 0x08, 0x7c, 0x1d, 0x66, 0x7c,
+    0x1d, 0x1c, 0xff, 0x00, 0xc5, 0x01, 0xd9, 0x02,
+    0x01, 0x0f, 0x0f, 0x01, 0x11, 0x0c, 0x07, 0x02,
+    0x3c, 0x6e, 0x61, 0x3c, 0x6e, 0x3c, 0x09, 0x07,
+    0x80, 0x42, 0x10, 0x01, 0x42, 0x10, 0x42, 0xff,
+    0x00, 0xd5, 0x01, 0xd9, 0x02, 0x01, 0x0f, 0x0f,
+    0x01, 0x11, 0x0c, 0x07, 0x02, 0x3c, 0x6e, 0x61,
+    0x3c, 0x6e, 0x3c, 0xff, 0x00, 0xe5, 0x01, 0xd9,
+    0x02, 0x01, 0x0f, 0x0f, 0x01, 0x11, 0xff, 0x00,
+    0xf5, 0x01, 0xd9, 0x02, 0x01, 0x0f
+};
+
+static const ElementDeltas element_deltas_mode_mode_cod = {
+    .resource = &resource_mode_cod,
+    .steps = {
+        { {  32, 18,  56, 11 },   94, element_deltas_mode_mode_cod_runs + 0 },
+        { {  32, 19,  56, 11 },   94, element_deltas_mode_mode_cod_runs + 94 },
+        { {  32, 20,  56, 11 },   94, element_deltas_mode_mode_cod_runs + 188 },
+        { {  32, 21,  56, 11 },   94, element_deltas_mode_mode_cod_runs + 282 },
+        { {  32, 22,  56, 10 },   85, element_deltas_mode_mode_cod_runs + 376 },
+        { {  32, 23,  56,  9 },   76, element_deltas_mode_mode_cod_runs + 461 },
+        { {  32, 24,  56,  8 },   66, element_deltas_mode_mode_cod_runs + 537 },
+        { {  32, 25,  56,  7 },   57, element_deltas_mode_mode_cod_runs + 603 },
+        { {  32, 26,  56,  6 },   48, element_deltas_mode_mode_cod_runs + 660 },
+        { {  32, 27,  56,  5 },   38, element_deltas_mode_mode_cod_runs + 708 },
+        { {  32, 28,  56,  4 },   29, element_deltas_mode_mode_cod_runs + 746 },
+        { {  32, 29,  56,  3 },   20, element_deltas_mode_mode_cod_runs + 775 },
+        { {  32, 30,  32,  2 },   11, element_deltas_mode_mode_cod_runs + 795 },
+        { {  32, 31,  32,  1 },    8, element_deltas_mode_mode_cod_runs + 806 },
+        { {   0,  0,   0,  0 },    0, element_deltas_mode_mode_cod_runs + 814 }
+    },
+    .appear = { {   0,  0,   0,  0 },    0, element_deltas_mode_mode_cod_runs + 814 }
+};
+
+// MODE showing resource_mode_fn
+static const uint8_t element_deltas_mode_mode_fn_runs[258] = {
+    0xff, 0x00, 0x25, 0x01, 0xfc, 0x1f, 0x02, 0x3c,
+    0xd8, 0x0f, 0x01, 0x24, 0x0e, 0x02, 0x3c, 0x30,
+    0x0f, 0x01, 0x08, 0x0e, 0x01, 0x3c, 0x3f, 0x02,
+    0xc0, 0xc4, 0xff, 0x00, 0x35, 0x01, 0xfc, 0x1f,
+    0x02, 0x3c, 0xd8, 0x0f, 0x01, 0x24, 0x0e, 0x02,
+    0x3c, 0x30, 0x0f, 0x01, 0x08, 0x0e, 0x01, 0x3c,
+    0x3f, 0x02, 0xc0, 0xc4, 0xff, 0x00, 0x45, 0x01,
+    0xfc, 0x1f, 0x02, 0x3c, 0xd8, 0x0f, 0x01, 0x24,
+    0x0e, 0x02, 0x3c, 0x30, 0x0f, 0x01, 0x08, 0x0e,
+    0x01, 0x3c, 0x3f, 0x02, 0xc0, 0xc4, 0xff, 0x00,
+    0x55, 0x01, 0xfc, 0x1f, 0x02, 0x3c, 0xd8, 0x0f,
+    0x01, 0x24, 0x0e, 0x02, 0x3c, 0x30, 0x0f, 0x01,
+    0x08, 0x0e, 0x01, 0x3c, 0x3f, 0x02, 0xc0, 0xc4,
+    0xff, 0x00, 0x65, 0x01, 0xfc, 0x1f, 0x02, 0x3c,
+    0xd8, 0x0f, 0x01, 0x24, 0x0e, 0x02, 0x3c, 0x30,
+    0x0f, 0x01, 0x08, 0x0e, 0x01, 0x3c, 0xff, 0x00,
+    0x75, 0x01, 0xfc, 0x1f, 0x02, 0x3c, 0xd8, 0x0f,
+    0x01, 0x24, 0x0e, 0x02, 0x3c, 0x30, 0x0f, 0x01,
+    0x08, 0x0e, 0x01, 0x3c, 0xff, 0x00, 0x85, 0x01,
+    0xfc, 0x1f, 0x02, 0x3c, 0xd8, 0x0f, 0x01, 0x24,
+    0x0e, 0x02, 0x3c, 0x30, 0x0f, 0x01, 0x08, 0x0e,
+    0x01, 0x3c, 0xff, 0x00, 0x95, 0x01, 0xfc, 0x1f,
+    0x02, 0x3c, 0xd8, 0x0f, 0x01, 0x24, 0x0e, 0x02,
+    0x3c, 0x30, 0x0f, 0x01, 0x08, 0x0e, 0x01, 0x3c,
+    0xff, 0x00, 0xa5, 0x01, 0xfc, 0x1f, 0x02, 0x3c,
+    0xd8, 0x0f, 0x01, 0x24, 0x0e, 0x02, 0x3c, 0x30,
+    0x0f, 0x01, 0x08, 0xff, 0x00, 0xb5, 0x01, 0xfc,
+    0x1f, 0x02, 0x3c, 0xd8, 0x0f, 0x01, 0x24, 0x0e,
+    0x02, 0x3c, 0x30, 0xff, 0x00, 0xc5, 0x01, 0xfc,
+    0x1f, 0x02, 0x3c, 0xd8, 0x0f, 0x01, 0x24, 0xff,
+    0x00, 0xd5, 0x01, 0xfc, 0x1f, 0x02, 0x3c, 0xd8,
+    0xff, 0x00, 0xe5, 0x01, 0xfc, 0xff, 0x00, 0xf5,
+    0x01, 0xfc
+};
+
+static const ElementDeltas element_deltas_mode_mode_fn = {
+    .resource = &resource_mode_fn,
+    .steps = {
+        { {  32, 18,  16, 11 },   26, element_deltas_mode_mode_fn_runs + 0 },
+        { {  32, 19,  16, 11 },   26, element_deltas_mode_mode_fn_runs + 26 },
+        { {  32, 20,  16, 11 },   26, element_deltas_mode_mode_fn_runs + 52 },
+        { {  32, 21,  16, 11 },   26, element_deltas_mode_mode_fn_runs + 78 },
+        { {  32, 22,  16,  7 },   22, element_deltas_mode_mode_fn_runs + 104 },
+        { {  32, 23,  16,  7 },   22, element_deltas_mode_mode_fn_runs + 126 },
+        { {  32, 24,  16,  7 },   22, element_deltas_mode_mode_fn_runs + 148 },
+        { {  32, 25,  16,  7 },   22, element_deltas_mode_mode_fn_runs + 170 },
+        { {  32, 26,  16,  6 },   19, element_deltas_mode_mode_fn_runs + 192 },
+        { {  32, 27,  16,  5 },   16, element_deltas_mode_mode_fn_runs + 211 },
+        { {  32, 28,  16,  4 },   12, element_deltas_mode_mode_fn_runs + 227 },
+        { {  32, 29,  16,  3 },    9, element_deltas_mode_mode_fn_runs + 239 },
+        { {  32, 30,   8,  1 },    5, element_deltas_mode_mode_fn_runs + 248 },
+        { {  32, 31,   8,  1 },    5, element_deltas_mode_mode_fn_runs + 253 },
+        { {   0,  0,   0,  0 },    0, element_deltas_mode_mode_fn_runs + 258 }
+    },
+    .appear = { {   0,  0,   0,  0 },    0, element_deltas_mode_mode_fn_runs + 258 }
+};
+
+static const ElementDeltas *const ElementDeltaMap[TOTAL_LAYERS][TOTAL_ELEMENTS] = {
+    { &element_deltas_logo_logo_win, &element_deltas_name_name_win, &element_deltas_layer_symbol_symbol_keyboard, &element_deltas_mode_mode_mode },
+    { &element_deltas_logo_logo_mac, &element_deltas_name_name_mac, &element_deltas_layer_symbol_symbol_keyboard, &element_deltas_mode_mode_mode },
+    { &element_deltas_logo_logo_win, &element_deltas_name_name_gam, &element_deltas_layer_symbol_symbol_controller, &element_deltas_mode_mode_mode },
+    { &element_deltas_logo_logo_cod, &element_deltas_name_name_cod, &element_deltas_layer_symbol_symbol_controller, &element_deltas_mode_mode_cod },
+    { NULL, NULL, &element_deltas_layer_symbol_symbol_keyboard, &element_deltas_mode_mode_fn }
+};
@@ -0,0 +1,145 @@
+/**
+ * Runs every transition between two layers and reports what it costs.
+ *
+ * A transition starts from the keyboard resting on WIN_LAYOUT and then on
+ * the layer it starts from, so that the elements a layer leaves alone (like
+ * FN_LAYER's logo) are the same every time. 100 ms later the layer is
+ * switched, and the transition lasts until the visualizer thread has nothing
+ * left to wake up for, which includes the backlight fade.
+ *
+ * The counts are the same on every run. The times are the host's CPU time
+ * and vary a little, every transition is run repeats times (the first
+ * argument, 20 by default) and the times are averaged over all of them.
+ *
+ * anim: animation_routine calls, mean and max CPU time per call
+ * framebuffer: lcd_framebuffer_compose blits and fills, the pixels they
+ *      wrote, and the deltas XORed into it
+ * driver: gdispGBlitArea calls and the bytes they read from the framebuffer
+ * lcd: frames sent to the LCD and their bytes on the SPI bus
+ * thread: wakeups of the visualizer thread, and how long the transition took
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host.h"
+#include "visualizer-stats.h"
+
+typedef struct {
+    uint32_t animation_calls;
+    uint64_t animation_time;
+    uint32_t animation_max_time;
+    uint32_t blits;
+    uint32_t fills;
+    uint32_t pixels;
+    uint32_t deltas;
+    uint32_t delta_bytes;
+    uint32_t region_blits;
+    uint32_t region_bytes;
+    uint32_t flushes;
+    uint32_t spi_bytes;
+    uint32_t wakeups;
+    systemticks_t duration;
+} TransitionCost;
+
+static void run_transition(const Layers from, const Layers to, TransitionCost *const cost) {
+    host_settle(host_layer_state(WIN_LAYOUT), 5000);
+    host_settle(host_layer_state(from), 5000);
+    // keys aren't pressed within a FRAME_TIME of each other, that would be coalesced
+    host_scan_until(host_layer_state(from), host_get_time() + 100);
+
+    visualizer_stats_reset();
+    host_reset_counters();
+
+    const systemticks_t duration = host_settle(host_layer_state(to), 5000);
+    const host_counters_t *const counters = host_get_counters(0);
+
+    // every repeat does the same, the counts are only kept once
+    *cost = (TransitionCost){
+        .animation_calls = visualizer_stats.animation_routine_calls,
+        .animation_time = cost->animation_time + visualizer_stats.animation_routine_time,
+        .animation_max_time = visualizer_stats.animation_routine_max_time > cost->animation_max_time
+            ? visualizer_stats.animation_routine_max_time
+            : cost->animation_max_time,
+        .blits = visualizer_stats.blits,
+        .fills = visualizer_stats.fills,
+        .pixels = visualizer_stats.pixels_drawn,
+        .deltas = visualizer_stats.deltas,
+        .delta_bytes = visualizer_stats.delta_bytes,
+        .region_blits = counters->blits,
+        .region_bytes = counters->blit_bytes,
+        .flushes = counters->flushes,
+        .spi_bytes = counters->spi_bytes,
+        .wakeups = counters->wakeups,
+        .duration = duration
+    };
+}
+
+static void print_cost(const char *const name, const TransitionCost *const cost, const unsigned repeats) {
+    const uint32_t calls = cost->animation_calls * repeats;
+
+    printf("%-12s %5lu %7lu %7lu | %5lu %5lu %7lu %5lu %6lu | %5lu %6lu | %5lu %7lu | %5lu %6lu\n",
+        name,
+        (unsigned long)cost->animation_calls,
+        (unsigned long)(calls > 0 ? cost->animation_time / calls : 0),
+        (unsigned long)cost->animation_max_time,
+        (unsigned long)cost->blits,
+        (unsigned long)cost->fills,
+        (unsigned long)cost->pixels,
+        (unsigned long)cost->deltas,
+        (unsigned long)cost->delta_bytes,
+        (unsigned long)cost->region_blits,
+        (unsigned long)cost->region_bytes,
+        (unsigned long)cost->flushes,
+        (unsigned long)cost->spi_bytes,
+        (unsigned long)cost->wakeups,
+        (unsigned long)cost->duration);
+}
+
+int main(int argc, char **argv) {
+    const unsigned repeats = argc > 1 ? (unsigned)atoi(argv[1]) : 20;
+    TransitionCost costs[TOTAL_LAYERS][TOTAL_LAYERS] = { 0 };
+    TransitionCost total = { 0 };
+
+    if (repeats == 0) host_fail("usage: %s [repeats]", argv[0]);
+
+    host_boot(WIN_LAYOUT);
+
+    for (unsigned repeat = 0; repeat < repeats; repeat++) {
+        for (Layers from = 0; from < TOTAL_LAYERS; from++) {
+            for (Layers to = 0; to < TOTAL_LAYERS; to++) run_transition(from, to, &costs[from][to]);
+        }
+    }
+
+    printf("%-12s %5s %7s %7s | %5s %5s %7s %5s %6s | %5s %6s | %5s %7s | %5s %6s\n",
+        "", "anim", "mean ns", "max ns", "blits", "fills", "pixels", "delta", "bytes", "blits", "bytes", "lcd", "spi B", "wake", "ms");
+
+    for (Layers from = 0; from < TOTAL_LAYERS; from++) {
+        for (Layers to = 0; to < TOTAL_LAYERS; to++) {
+            const TransitionCost *const cost = &costs[from][to];
+            char name[16];
+
+            snprintf(name, sizeof(name), "%s>%s", host_layer_name(from), host_layer_name(to));
+            print_cost(name, cost, repeats);
+
+            total.animation_calls += cost->animation_calls;
+            total.animation_time += cost->animation_time;
+            if (cost->animation_max_time > total.animation_max_time) total.animation_max_time = cost->animation_max_time;
+            total.blits += cost->blits;
+            total.fills += cost->fills;
+            total.pixels += cost->pixels;
+            total.deltas += cost->deltas;
+            total.delta_bytes += cost->delta_bytes;
+            total.region_blits += cost->region_blits;
+            total.region_bytes += cost->region_bytes;
+            total.flushes += cost->flushes;
+            total.spi_bytes += cost->spi_bytes;
+            total.wakeups += cost->wakeups;
+            total.duration += cost->duration;
+        }
+    }
+
+    print_cost("total", &total, repeats);
+
+    return EXIT_SUCCESS;
+}
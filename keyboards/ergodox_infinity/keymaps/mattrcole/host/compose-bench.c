@@ -0,0 +1,353 @@
+/**
+ * Compares lcd_framebuffer_compose with the way the elements used to be
+ * drawn, straight into the display driver with gdispGBlitArea and
+ * gdispGFillArea.
+ *
+ * Both go into a model of the ST7565 driver's RAM, pages 8 pixels tall with
+ * a byte per column, written one pixel at a time the way its blit and fill
+ * do. The old path called them for an element's visible area, and for the
+ * strip it left behind when sliding out, from a raw bitmap the size of the
+ * element. The new path composes the element into the framebuffer, and the
+ * flush then copies the changed region into the driver with a single
+ * gdispGBlitArea, which is linked wrapped to end up in the model too.
+ *
+ * First, random areas with random offsets and clipping, from RAW, PACKBITS
+ * and PAGES bitmaps up to 255 pixels wide, are composed over random screens
+ * and checked against a fill of the area followed by a blit of the bitmap,
+ * pixel for pixel. PAGES bitmaps wider than the LCD are black past its
+ * width, see host_decode_bitmap. Then
+ * every element slides out and back in on every bitmap it has, through
+ * both paths, and the CPU time per drawn frame is reported:
+ *
+ * old: gdispGBlitArea of the element, and gdispGFillArea of the strip
+ * compose: handle_slide_animation_common, dirty regions included
+ * +flush: and the copy of the region into the driver
+ *
+ * compose-bench [repeats] [random cases]: 2000 and 20000 by default
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+#include "../animation-keyframes.c"
+
+#define PAGES (LCD_HEIGHT / 8)
+#define MAX_BITMAP_WIDTH UINT8_MAX
+#define MAX_BITMAP_BYTES ((MAX_BITMAP_WIDTH + 7) / 8 * LCD_HEIGHT)
+
+typedef uint8_t DriverRam[PAGES][LCD_WIDTH];
+
+static DriverRam old_ram, new_ram;
+
+// what the wrapped gdispGBlitArea does with the framebuffer's flushes
+static bool copy_flushes = true;
+
+static uint32_t random_state = 1;
+
+// xorshift32, so that every run checks the same cases
+static uint32_t random_below(const uint32_t limit) {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+
+    return random_state % limit;
+}
+
+// gdispGBlitArea and gdispGFillArea clip the area to the screen before the driver gets it
+static bool clip_area(int *const x, int *const y, int *const cx, int *const cy, int *const srcx, int *const srcy) {
+    if (*x < 0) { *cx += *x; *srcx -= *x; *x = 0; }
+    if (*y < 0) { *cy += *y; *srcy -= *y; *y = 0; }
+    if (*x + *cx > LCD_WIDTH) *cx = LCD_WIDTH - *x;
+    if (*y + *cy > LCD_HEIGHT) *cy = LCD_HEIGHT - *y;
+
+    return *cx > 0 && *cy > 0;
+}
+
+static void driver_blit(DriverRam ram, int x, int y, int cx, int cy, int srcx, int srcy, const int srccx, const uint8_t *const buffer) {
+    if (!clip_area(&x, &y, &cx, &cy, &srcx, &srcy)) return;
+
+    for (int i = 0; i < cy; i++) {
+        const int dsty = y + i;
+        unsigned srcbit = (srcy + i) * srccx + srcx;
+
+        for (int j = 0; j < cx; j++, srcbit++) {
+            uint8_t *const dst = &ram[dsty / 8][x + j];
+
+            if ((buffer[srcbit / 8] >> (7 - srcbit % 8)) & 1) *dst |= 1 << (dsty % 8);
+            else *dst &= ~(1 << (dsty % 8));
+        }
+    }
+}
+
+static void driver_fill(DriverRam ram, int x, int y, int cx, int cy, const gColor color) {
+    int srcx = 0, srcy = 0;
+
+    if (!clip_area(&x, &y, &cx, &cy, &srcx, &srcy)) return;
+
+    for (int dsty = y; dsty < y + cy; dsty++) {
+        for (int dstx = x; dstx < x + cx; dstx++) {
+            if (color != Black) ram[dsty / 8][dstx] |= 1 << (dsty % 8);
+            else ram[dsty / 8][dstx] &= ~(1 << (dsty % 8));
+        }
+    }
+}
+
+void __wrap_gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer) {
+    if (copy_flushes) driver_blit(new_ram, x, y, cx, cy, srcx, srcy, srccx, buffer);
+}
+
+// a raw bitmap of the given pixels, one byte each
+static void pack_raw(const uint8_t *const pixels, const int width, const int height, uint8_t *const data) {
+    const int row_bytes = (width + 7) / 8;
+
+    memset(data, 0, row_bytes * height);
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (pixels[y * width + x]) data[y * row_bytes + x / 8] |= 0x80 >> (x % 8);
+        }
+    }
+}
+
+static void check_random_case(const unsigned number) {
+    static uint8_t pixels[LCD_HEIGHT * MAX_BITMAP_WIDTH];
+    static uint8_t raw[MAX_BITMAP_BYTES], data[MAX_BITMAP_BYTES * 2];
+    const int width = 1 + random_below(MAX_BITMAP_WIDTH);
+    const int height = 1 + random_below(LCD_HEIGHT);
+    const int row_bytes = (width + 7) / 8;
+    resource_bitmap_t bitmap = { .width = width, .height = height, .data = data };
+
+    for (int i = 0; i < width * height; i++) pixels[i] = random_below(2);
+    pack_raw(pixels, width, height, raw);
+
+    switch (random_below(3)) {
+        case RESOURCE_FORMAT_RAW:
+            bitmap.format = RESOURCE_FORMAT_RAW;
+            bitmap.size = row_bytes * height;
+            memcpy(data, raw, bitmap.size);
+            break;
+
+        case RESOURCE_FORMAT_PACKBITS:
+            // literal runs of random lengths, with a repeat of the byte after each
+            bitmap.format = RESOURCE_FORMAT_PACKBITS;
+            bitmap.size = 0;
+            for (int i = 0; i < row_bytes * height;) {
+                const int literal = 1 + random_below(row_bytes * height - i < 128 ? row_bytes * height - i : 128);
+
+                data[bitmap.size++] = literal - 1;
+                memcpy(&data[bitmap.size], &raw[i], literal);
+                bitmap.size += literal;
+                i += literal;
+
+                int repeat = 0;
+                while (i + repeat < row_bytes * height && raw[i + repeat] == raw[i] && repeat < 128) repeat++;
+                if (repeat < 2) continue;
+
+                data[bitmap.size++] = 257 - repeat;
+                data[bitmap.size++] = raw[i];
+                i += repeat;
+            }
+            break;
+
+        default:
+            bitmap.format = RESOURCE_FORMAT_PAGES;
+            bitmap.size = (height + 7) / 8 * width;
+            memset(data, 0, bitmap.size);
+            for (int y = 0; y < height; y++) {
+                for (int x = 0; x < width; x++) data[(y / 8) * width + x] |= pixels[y * width + x] << (y % 8);
+            }
+            break;
+    }
+
+    // anywhere from all the way off screen on one side to the other
+    const int x = (int)random_below(LCD_WIDTH + 40) - 20;
+    const int y = (int)random_below(LCD_HEIGHT + 20) - 10;
+    const int area_width = random_below(LCD_WIDTH + 1);
+    const int area_height = random_below(LCD_HEIGHT + 1);
+    const int offset_x = (int)random_below(2 * LCD_WIDTH) - LCD_WIDTH;
+    const int offset_y = (int)random_below(2 * LCD_HEIGHT) - LCD_HEIGHT;
+    const gColor fill = random_below(2) ? White : Black;
+
+    // a screen of random pixels on both sides
+    for (int i = 0; i < LCD_HEIGHT * LCD_WIDTH; i++) pixels[i] = random_below(2);
+    pack_raw(pixels, LCD_WIDTH, LCD_HEIGHT, raw);
+    driver_blit(old_ram, 0, 0, LCD_WIDTH, LCD_HEIGHT, 0, 0, LCD_WIDTH, raw);
+    lcd_framebuffer_blit(0, 0, LCD_WIDTH, LCD_HEIGHT, 0, 0, LCD_WIDTH, raw);
+
+    // the old way: erase the area, then blit the part of the bitmap that lies within it
+    const int left = x > x + offset_x ? x : x + offset_x;
+    const int top = y > y + offset_y ? y : y + offset_y;
+    const int right = x + area_width < x + offset_x + width ? x + area_width : x + offset_x + width;
+    const int bottom = y + area_height < y + offset_y + height ? y + area_height : y + offset_y + height;
+
+    driver_fill(old_ram, x, y, area_width, area_height, fill);
+    if (left < right && top < bottom) {
+        host_decode_bitmap(&bitmap, pixels, width);
+        pack_raw(pixels, width, height, raw);
+        // the driver reads the rows as one stream of bits, the padding at the end of them included
+        driver_blit(old_ram, left, top, right - left, bottom - top, left - x - offset_x, top - y - offset_y, row_bytes * 8, raw);
+    }
+
+    lcd_framebuffer_compose(x, y, area_width, area_height, offset_x, offset_y, &bitmap, fill);
+    lcd_framebuffer_flush();
+
+    if (memcmp(old_ram, new_ram, sizeof(DriverRam)) != 0) {
+        host_fail("case %u: composing %dx%d at %d, %d with a %dx%d bitmap of format %d at an offset of %d, %d doesn't match the old path",
+            number, area_width, area_height, x, y, width, height, bitmap.format, offset_x, offset_y);
+    }
+}
+
+typedef struct {
+    uint32_t frames;
+    uint64_t old_time;
+    uint64_t compose_time;
+    uint64_t flush_time;
+} SlideCost;
+
+// The bitmap of an element, raw and the size of the element, the way the old path used it
+static uint8_t element_raw[TOTAL_LAYERS][TOTAL_ELEMENTS][MAX_BITMAP_BYTES];
+
+/**
+ * What the old path drew for an element moving from frame to next_frame:
+ * the element at next_frame, if that looks any different, and the strip
+ * between the two when sliding out.
+*/
+static void draw_old(const ElementList element, const Layers layer, const uint8_t frame, const uint8_t next_frame) {
+    const ElementFrameOperation *const resting = &ElementFrameOperations[element][RESTING];
+    const ElementFrameOperation *const operation = &ElementFrameOperations[element][next_frame];
+    const ElementFrameOperation *const all_out = &ElementFrameOperations[element][TOTAL_FRAMES];
+    const Axis axis = all_out->visible_area[X] != resting->visible_area[X] ? X : Y;
+    const bool positive = all_out->visible_position[axis] > resting->visible_position[axis];
+    const uint8_t offset = operation->offset_in_pixels;
+    const uint8_t pixel_delta = next_frame > frame
+        ? offset - ElementFrameOperations[element][frame].offset_in_pixels
+        : ElementFrameOperations[element][frame].offset_in_pixels - offset;
+
+    driver_blit(old_ram,
+        operation->visible_position[X],
+        operation->visible_position[Y],
+        operation->visible_area[X],
+        operation->visible_area[Y],
+        operation->visible_position[X] - operation->bitmap_position[X],
+        operation->visible_position[Y] - operation->bitmap_position[Y],
+        resting->visible_area[X],
+        element_raw[layer][element]);
+
+    if (next_frame < frame) return;
+
+    int erase_position[2] = { resting->visible_position[X], resting->visible_position[Y] };
+    int erase_area[2] = { resting->visible_area[X], resting->visible_area[Y] };
+
+    if (!positive) erase_position[axis] = resting->visible_position[axis] + resting->visible_area[axis] - 1 - offset;
+    erase_area[axis] = pixel_delta + 1;
+
+    driver_fill(old_ram, erase_position[X], erase_position[Y], erase_area[X], erase_area[Y], ScreenEraseColor);
+}
+
+// the frames of a slide out and back in that look any different from the one before
+static uint8_t get_slide_frames(const ElementList element, uint8_t frames[2 * TOTAL_FRAMES + 1]) {
+    uint8_t count = 0;
+
+    frames[count++] = RESTING;
+    for (uint8_t frame = 1; frame <= TOTAL_FRAMES; frame++) {
+        if (!ElementFrameOperations[element][frame].skip) frames[count++] = frame;
+    }
+    for (uint8_t frame = TOTAL_FRAMES; frame > RESTING; frame--) {
+        if (!ElementFrameOperations[element][frame].skip) frames[count++] = frame - 1;
+    }
+
+    return count;
+}
+
+static void run_slides(const ElementList element, const Layers layer, const unsigned repeats, SlideCost *const cost) {
+    uint8_t frames[2 * TOTAL_FRAMES + 1];
+    const uint8_t count = get_slide_frames(element, frames);
+
+    cost->frames += count - 1;
+
+    uint32_t start = host_cpu_clock();
+    for (unsigned repeat = 0; repeat < repeats; repeat++) {
+        for (uint8_t i = 1; i < count; i++) draw_old(element, layer, frames[i - 1], frames[i]);
+    }
+    cost->old_time += (uint32_t)(host_cpu_clock() - start);
+
+    copy_flushes = false;
+    start = host_cpu_clock();
+    for (unsigned repeat = 0; repeat < repeats; repeat++) {
+        for (uint8_t i = 1; i < count; i++) {
+            handle_slide_animation_common(element, frames[i], frames[i - 1], layer);
+            lcd_framebuffer_flush();
+        }
+    }
+    cost->compose_time += (uint32_t)(host_cpu_clock() - start);
+
+    copy_flushes = true;
+    start = host_cpu_clock();
+    for (unsigned repeat = 0; repeat < repeats; repeat++) {
+        for (uint8_t i = 1; i < count; i++) {
+            handle_slide_animation_common(element, frames[i], frames[i - 1], layer);
+            lcd_framebuffer_flush();
+        }
+    }
+    cost->flush_time += (uint32_t)(host_cpu_clock() - start);
+}
+
+static void print_cost(const char *const name, const SlideCost *const cost, const unsigned repeats) {
+    const uint64_t draws = (uint64_t)cost->frames * repeats;
+
+    printf("%-14s %6lu %8lu %8lu %8lu\n",
+        name,
+        (unsigned long)cost->frames,
+        (unsigned long)(cost->old_time / draws),
+        (unsigned long)(cost->compose_time / draws),
+        (unsigned long)(cost->flush_time / draws));
+}
+
+int main(int argc, char **argv) {
+    static const char *const ElementNames[TOTAL_ELEMENTS] = { "logo", "name", "layer_symbol", "mode" };
+    const unsigned repeats = argc > 1 ? (unsigned)atoi(argv[1]) : 2000;
+    const unsigned random_cases = argc > 2 ? (unsigned)atoi(argv[2]) : 20000;
+    static uint8_t pixels[LCD_HEIGHT * LCD_WIDTH];
+    SlideCost total = { 0 };
+
+    if (repeats == 0) host_fail("usage: %s [repeats] [random cases]", argv[0]);
+
+    for (unsigned number = 0; number < random_cases; number++) check_random_case(number);
+
+    printf("%u random areas composed like the old path drew them\n\n", random_cases);
+    printf("%-14s %6s %8s %8s %8s\n", "ns per frame", "frames", "old", "compose", "+flush");
+
+    lcd_framebuffer_clear(ScreenEraseColor);
+    lcd_framebuffer_flush();
+    memcpy(old_ram, new_ram, sizeof(DriverRam));
+
+    for (ElementList element = 0; element < TOTAL_ELEMENTS; element++) {
+        SlideCost cost = { 0 };
+
+        for (Layers layer = 0; layer < TOTAL_LAYERS; layer++) {
+            const resource_bitmap_t *const bitmap = ElementResourceMap[layer][element];
+            bool seen = bitmap == NULL;
+
+            for (Layers other = 0; other < layer; other++) seen |= ElementResourceMap[other][element] == bitmap;
+            if (seen) continue;
+
+            host_decode_bitmap(bitmap, pixels, bitmap->width);
+            pack_raw(pixels, bitmap->width, bitmap->height, element_raw[layer][element]);
+
+            run_slides(element, layer, repeats, &cost);
+        }
+
+        print_cost(ElementNames[element], &cost, repeats);
+
+        total.frames += cost.frames;
+        total.old_time += cost.old_time;
+        total.compose_time += cost.compose_time;
+        total.flush_time += cost.flush_time;
+    }
+
+    print_cost("total", &total, repeats);
+
+    return EXIT_SUCCESS;
+}
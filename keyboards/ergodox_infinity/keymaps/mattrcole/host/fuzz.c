@@ -0,0 +1,277 @@
+/**
+ * Throws random timed layer sequences at the slide animation and checks it
+ * after every pass of the visualizer thread.
+ *
+ * The layers are switched through the matrix scans, so they take the same
+ * way update_my_animation_handler is called on the keyboard, coalescing
+ * included. Some of them come faster than a FRAME_TIME apart, and the
+ * visualizer thread is stalled now and then, so that frames get dropped.
+ * The checks:
+ *
+ * - current_animation never has more than MAX_ANIMATION_FRAMES frames, or
+ *   steps, or more than MAX_ANIMATION_RUNS runs
+ * - no element jumps: since the animation was scheduled, an element never
+ *   moved more curve steps on screen than there were FRAME_TIMEs since its
+ *   start, plus the one of the first frame. Only the SNAP layers may jump.
+ * - the LCD always shows every element exactly at its current_state
+ * - after the last layer of a sequence every element comes to rest, showing
+ *   the last layer's bitmap if it has one, and the time that took is the
+ *   convergence time reported at the end
+ *
+ * This file includes animation-keyframes.c to get at its state, and is
+ * linked with start_keyframe_animation and stop_keyframe_animation wrapped
+ * to see current_animation being scheduled or stopped for a snap.
+ *
+ * fuzz [sequences] [seed]: 2000 sequences and seed 1 by default
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host.h"
+#include "../animation-keyframes.c"
+
+#define MAX_SEQUENCE_LENGTH 12
+// a sequence that hasn't converged after this long never will
+#define CONVERGENCE_LIMIT 5000
+#define MAX_STALL (3 * FRAME_TIME)
+
+static uint32_t random_state;
+
+// xorshift32, so that a seed gives the same run everywhere
+static uint32_t random_below(const uint32_t limit) {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+
+    return random_state % limit;
+}
+
+// What the elements' bitmaps look like, decoded one pixel at a time
+static uint8_t element_pixels[TOTAL_LAYERS][TOTAL_ELEMENTS][LCD_HEIGHT][LCD_WIDTH];
+
+// What the LCD should show for the elements' current_state
+static void render_elements(host_frame_t frame) {
+    memset(frame, White, sizeof(host_frame_t));
+
+    for (ElementList element = 0; element < TOTAL_ELEMENTS; element++) {
+        const Layers layer = current_state[element].layer;
+        const resource_bitmap_t *const bitmap = ElementResourceMap[layer][element];
+        const ElementFrameOperation *const operation = &ElementFrameOperations[element][current_state[element].frame];
+
+        if (bitmap == NULL) continue;
+
+        for (int y = operation->visible_position[Y]; y < operation->visible_position[Y] + operation->visible_area[Y]; y++) {
+            for (int x = operation->visible_position[X]; x < operation->visible_position[X] + operation->visible_area[X]; x++) {
+                const int bitmap_x = x - operation->bitmap_position[X];
+                const int bitmap_y = y - operation->bitmap_position[Y];
+                const bool inside = bitmap_x >= 0 && bitmap_x < bitmap->width && bitmap_y >= 0 && bitmap_y < bitmap->height;
+
+                frame[y][x] = inside ? element_pixels[layer][element][bitmap_y][bitmap_x] : White;
+            }
+        }
+    }
+}
+
+// the curve steps an element moves on screen from frame to frame of the same bitmap
+static unsigned count_visible_steps(const ElementList element, const uint8_t from, const uint8_t to) {
+    const uint8_t first = from < to ? from : to;
+    const uint8_t last = from < to ? to : from;
+    unsigned steps = 0;
+
+    for (uint8_t frame = first + 1; frame <= last; frame++) steps += !ElementFrameOperations[element][frame].skip;
+
+    return steps;
+}
+
+// where the elements were last seen, and how far they moved since current_animation was scheduled
+static ElementState seen_state[TOTAL_ELEMENTS];
+static unsigned visible_steps[TOTAL_ELEMENTS];
+static bool snapped;
+// animation_start of the animation the steps count against
+static systemticks_t counted_start;
+
+static unsigned sequence;
+static systemticks_t last_layer_change;
+static systemticks_t worst_convergence;
+static unsigned worst_sequence;
+static uint32_t checks;
+
+static void start_counting_steps(void) {
+    memcpy(seen_state, current_state, sizeof(seen_state));
+    memset(visible_steps, 0, sizeof(visible_steps));
+    snapped = false;
+}
+
+static void check_elements_moved(void) {
+    if (snapped) {
+        start_counting_steps();
+        return;
+    }
+
+    const systemticks_t elapsed = gfxSystemTicks() - counted_start;
+
+    for (ElementList element = 0; element < TOTAL_ELEMENTS; element++) {
+        const ElementState *const seen = &seen_state[element];
+        const ElementState *const current = &current_state[element];
+
+        // layers with the same bitmap are swapped anywhere, different bitmaps all the way out
+        visible_steps[element] += ElementResourceMap[seen->layer][element] == ElementResourceMap[current->layer][element]
+            ? count_visible_steps(element, seen->frame, current->frame)
+            : count_visible_steps(element, seen->frame, TOTAL_FRAMES) + count_visible_steps(element, TOTAL_FRAMES, current->frame);
+
+        if (visible_steps[element] > elapsed / FRAME_TIME + 1) {
+            host_fail("sequence %u at %lu ms: element %d moved %u curve steps within %lu ms of the animation's start",
+                sequence, (unsigned long)host_get_time(), element, visible_steps[element], (unsigned long)elapsed);
+        }
+
+        seen_state[element] = *current;
+    }
+}
+
+void __real_start_keyframe_animation(keyframe_animation_t* animation);
+void __real_stop_keyframe_animation(keyframe_animation_t* animation);
+
+void __wrap_start_keyframe_animation(keyframe_animation_t* animation) {
+    if (animation != &current_animation) {
+        __real_start_keyframe_animation(animation);
+        return;
+    }
+
+    // the steps of the animation that's replaced still count against it
+    check_elements_moved();
+    start_counting_steps();
+
+    counted_start = animation_start;
+
+    __real_start_keyframe_animation(animation);
+
+    unsigned steps = 0;
+    for (int run = 0; run < current_animation.num_runs; run++) steps += run_steps[run] * animation_runs[run].repeat;
+
+    if (current_animation.num_frames > MAX_ANIMATION_FRAMES || steps > MAX_ANIMATION_FRAMES || current_animation.num_runs > MAX_ANIMATION_RUNS) {
+        host_fail("sequence %u at %lu ms: scheduled %d frames of %u steps in %d runs",
+            sequence, (unsigned long)host_get_time(), current_animation.num_frames, steps, current_animation.num_runs);
+    }
+}
+
+// snap_elements_to_goal() stops current_animation right before it jumps
+void __wrap_stop_keyframe_animation(keyframe_animation_t* animation) {
+    if (animation == &current_animation) {
+        check_elements_moved();
+        snapped = true;
+    }
+
+    __real_stop_keyframe_animation(animation);
+}
+
+static void check_lcd(void) {
+    static host_frame_t expected;
+    const host_frame_t *const lcd = host_get_lcd(0);
+
+    render_elements(expected);
+
+    for (int y = 0; y < LCD_HEIGHT; y++) {
+        for (int x = 0; x < LCD_WIDTH; x++) {
+            if ((*lcd)[y][x] == expected[y][x]) continue;
+
+            host_fail("sequence %u at %lu ms: the LCD shows %s at %d, %d, the elements are at frames %u %u %u %u",
+                sequence, (unsigned long)host_get_time(), (*lcd)[y][x] ? "white" : "black", x, y,
+                current_state[LOGO].frame, current_state[NAME].frame, current_state[LAYER_SYMBOL].frame, current_state[MODE].frame);
+        }
+    }
+}
+
+static void check_pass(const uint8_t half) {
+    check_elements_moved();
+    check_lcd();
+    checks++;
+}
+
+static systemticks_t stall(const uint8_t half) { return random_below(8) == 0 ? 1 + random_below(MAX_STALL) : 0; }
+
+// the top layer, with a few random layers below it, the way MO() leaves them
+static layer_state_t random_layer_state(const Layers layer) {
+    return host_layer_state(layer) | (random_below(2) ? random_below(host_layer_state(layer)) : 0);
+}
+
+static systemticks_t random_gap(void) {
+    switch (random_below(3)) {
+        case 0: return 1 + random_below(FRAME_TIME); // coalesced
+        case 1: return FRAME_TIME + random_below(10 * FRAME_TIME); // in the middle of a slide
+        default: return 1 + random_below(40 * FRAME_TIME); // anything up to after the fade
+    }
+}
+
+static bool has_converged(const Layers layer) {
+    if (!my_animation_handler_is_idle()) return false;
+
+    for (ElementList element = 0; element < TOTAL_ELEMENTS; element++) {
+        const resource_bitmap_t *const bitmap = ElementResourceMap[layer][element];
+
+        if (bitmap != NULL && ElementResourceMap[current_state[element].layer][element] != bitmap) return false;
+    }
+
+    return true;
+}
+
+static void run_sequence(void) {
+    const unsigned length = 1 + random_below(MAX_SEQUENCE_LENGTH);
+
+    for (unsigned i = 1; i < length; i++) {
+        const Layers layer = random_below(TOTAL_LAYERS);
+
+        host_scan_until(random_layer_state(layer), host_get_time() + random_gap());
+    }
+
+    const Layers layer = random_below(TOTAL_LAYERS);
+    const layer_state_t layers = random_layer_state(layer);
+
+    last_layer_change = host_get_time();
+
+    do {
+        if (host_get_time() - last_layer_change > CONVERGENCE_LIMIT) {
+            host_fail("sequence %u: the elements didn't come to rest on %s within %d ms", sequence, host_layer_name(layer), CONVERGENCE_LIMIT);
+        }
+
+        host_scan(layers);
+        host_run_until(host_get_time() + 1);
+    } while (!has_converged(layer));
+
+    const systemticks_t convergence = host_get_time() - last_layer_change;
+
+    if (convergence > worst_convergence) {
+        worst_convergence = convergence;
+        worst_sequence = sequence;
+    }
+}
+
+int main(int argc, char **argv) {
+    const unsigned sequences = argc > 1 ? (unsigned)atoi(argv[1]) : 2000;
+    const uint32_t seed = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 0) : 1;
+
+    if (sequences == 0 || seed == 0) host_fail("usage: %s [sequences] [seed]", argv[0]);
+
+    random_state = seed;
+
+    for (Layers layer = 0; layer < TOTAL_LAYERS; layer++) {
+        for (ElementList element = 0; element < TOTAL_ELEMENTS; element++) {
+            if (ElementResourceMap[layer][element] != NULL) host_decode_bitmap(ElementResourceMap[layer][element], &element_pixels[layer][element][0][0], LCD_WIDTH);
+        }
+    }
+
+    host_boot(WIN_LAYOUT);
+
+    start_counting_steps();
+    counted_start = animation_start;
+    host_set_wakeup_hook(check_pass);
+    host_set_stall_hook(stall);
+
+    for (sequence = 0; sequence < sequences; sequence++) run_sequence();
+
+    printf("%u sequences, %lu passes of the visualizer thread checked\n", sequences, (unsigned long)checks);
+    printf("worst convergence after the last layer change: %lu ms (%lu frames), sequence %u\n",
+        (unsigned long)worst_convergence, (unsigned long)((worst_convergence + FRAME_TIME - 1) / FRAME_TIME), worst_sequence);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,128 @@
+/**
+ * Checks every transition between two layers against a golden image.
+ *
+ * The visualizer thread runs initialize_my_animation_handler and then
+ * update_my_animation_handler on the virtual clock of the host build, so a
+ * transition draws the same frames on every run. A transition starts the
+ * way it does in bench.c, and its golden image, goldens/<from>-<to>.pbm,
+ * stacks what the LCD showed before the layer was switched on top of every
+ * frame sent to the LCD until the visualizer was idle again. A frame that
+ * is the same as the one before it is left out: how often the LCD is
+ * flushed is what bench.c counts, and this way the frames drawn with and
+ * without VISUALIZER_ELEMENT_DELTAS are checked against the same images.
+ *
+ * golden <goldens> <output>: compares every frame pixel for pixel. For a
+ *      transition that doesn't match, <output>/<from>-<to>.actual.pbm holds
+ *      the frames it drew and <output>/<from>-<to>.diff.pbm the pixels that
+ *      differ in black, a frame that only one of them has is all black.
+ * golden --update <goldens>: writes the golden images instead.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+
+// The resting frame and the frames of a transition, well beyond the longest slide
+#define MAX_TRANSITION_FRAMES 64
+
+static host_frame_t frames[MAX_TRANSITION_FRAMES];
+static uint16_t num_frames;
+
+static void record_frame(const uint8_t half, const host_frame_t frame) {
+    if (num_frames == MAX_TRANSITION_FRAMES) host_fail("a transition sent more than %d frames to the LCD", MAX_TRANSITION_FRAMES - 1);
+
+    // sending the same frame again doesn't change what the LCD shows
+    if (memcmp(frames[num_frames - 1], frame, sizeof(host_frame_t)) == 0) return;
+
+    memcpy(frames[num_frames++], frame, sizeof(host_frame_t));
+}
+
+static void run_transition(const Layers from, const Layers to) {
+    host_settle(host_layer_state(WIN_LAYOUT), 5000);
+    host_settle(host_layer_state(from), 5000);
+    // keys aren't pressed within a FRAME_TIME of each other, that would be coalesced
+    host_scan_until(host_layer_state(from), host_get_time() + 100);
+
+    memcpy(frames[0], host_get_lcd(0), sizeof(host_frame_t));
+    num_frames = 1;
+
+    host_set_flush_hook(record_frame);
+    host_settle(host_layer_state(to), 5000);
+    host_set_flush_hook(NULL);
+}
+
+// Writes the pixels that differ, returns how many frames do
+static uint16_t write_diff(const char *const path, const host_frame_t *const golden, const uint16_t num_golden) {
+    static host_frame_t diff[MAX_TRANSITION_FRAMES];
+    const uint16_t num_diff = num_golden > num_frames ? num_golden : num_frames;
+    uint16_t frames_differing = 0;
+
+    for (uint16_t frame = 0; frame < num_diff; frame++) {
+        bool differs = false;
+
+        for (uint8_t y = 0; y < HOST_DISPLAY_HEIGHT; y++) {
+            for (uint8_t x = 0; x < HOST_DISPLAY_WIDTH; x++) {
+                const bool same = frame < num_golden && frame < num_frames && golden[frame][y][x] == frames[frame][y][x];
+
+                diff[frame][y][x] = same ? White : Black;
+                differs |= !same;
+            }
+        }
+
+        if (differs) frames_differing++;
+    }
+
+    if (!host_write_pbm(path, diff, num_diff)) host_fail("can't write %s", path);
+
+    return frames_differing;
+}
+
+int main(int argc, char **argv) {
+    const bool update = argc == 3 && strcmp(argv[1], "--update") == 0;
+    static host_frame_t golden[MAX_TRANSITION_FRAMES];
+    unsigned failures = 0;
+    char path[256];
+
+    if (argc != 3) host_fail("usage: %s <goldens> <output> | --update <goldens>", argv[0]);
+
+    host_boot(WIN_LAYOUT);
+
+    for (Layers from = 0; from < TOTAL_LAYERS; from++) {
+        for (Layers to = 0; to < TOTAL_LAYERS; to++) {
+            const char *const from_name = host_layer_name(from);
+            const char *const to_name = host_layer_name(to);
+
+            run_transition(from, to);
+
+            if (update) {
+                snprintf(path, sizeof(path), "%s/%s-%s.pbm", argv[2], from_name, to_name);
+                if (!host_write_pbm(path, frames, num_frames)) host_fail("can't write %s", path);
+
+                printf("%s>%s: %u frames\n", from_name, to_name, num_frames - 1);
+                continue;
+            }
+
+            snprintf(path, sizeof(path), "%s/%s-%s.pbm", argv[1], from_name, to_name);
+            const int num_golden = host_read_pbm(path, golden, MAX_TRANSITION_FRAMES);
+            if (num_golden < 0) host_fail("can't read %s", path);
+
+            if (num_golden == num_frames && memcmp(golden, frames, num_frames * sizeof(host_frame_t)) == 0) continue;
+
+            snprintf(path, sizeof(path), "%s/%s-%s.actual.pbm", argv[2], from_name, to_name);
+            if (!host_write_pbm(path, frames, num_frames)) host_fail("can't write %s", path);
+
+            snprintf(path, sizeof(path), "%s/%s-%s.diff.pbm", argv[2], from_name, to_name);
+            const uint16_t frames_differing = write_diff(path, golden, num_golden);
+
+            printf("%s>%s: %u of %u frames differ from the golden's %d, see %s\n",
+                from_name, to_name, frames_differing, num_frames - 1, num_golden - 1, path);
+            failures++;
+        }
+    }
+
+    if (!update) printf("%u of %u transitions match their golden images\n", TOTAL_LAYERS * TOTAL_LAYERS - failures, TOTAL_LAYERS * TOTAL_LAYERS);
+
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
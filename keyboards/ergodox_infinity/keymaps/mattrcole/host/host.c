@@ -0,0 +1,170 @@
+#include <stdio.h>
+#include <ctype.h>
+#include <string.h>
+
+#include "host.h"
+#include "visualizer.h"
+
+static const char *const LayerNames[TOTAL_LAYERS] = { "win", "mac", "gam", "cod", "fn" };
+
+layer_state_t host_layer_state(const Layers layer) { return (layer_state_t)1 << layer; }
+
+const char *host_layer_name(const Layers layer) { return layer < TOTAL_LAYERS ? LayerNames[layer] : "?"; }
+
+void host_scan(const layer_state_t layers) {
+    layer_state = layers;
+
+    visualizer_update(default_layer_state, layers, visualizer_get_mods(), 0);
+}
+
+void host_scan_until(const layer_state_t layers, const systemticks_t time) {
+    while ((int32_t)(time - host_get_time()) > 0) {
+        host_scan(layers);
+        host_run_until(host_get_time() + 1);
+    }
+}
+
+systemticks_t host_settle(const layer_state_t layers, const systemticks_t limit) {
+    const systemticks_t start = host_get_time();
+
+    do {
+        if (host_get_time() - start > limit) host_fail("the visualizer of half %u didn't settle within %lu ms", host_get_half(), (unsigned long)limit);
+
+        host_scan(layers);
+        host_run_until(host_get_time() + 1);
+    } while (!host_is_idle(host_get_half()));
+
+    return host_get_time() - start;
+}
+
+void host_boot(const Layers layer) {
+    default_layer_state = host_layer_state(WIN_LAYOUT);
+
+    visualizer_init();
+
+    // the startup animation takes 5 s, then the first layer slides in
+    host_settle(host_layer_state(layer), 10000);
+}
+
+static bool get_bitmap_pixel(const resource_bitmap_t *const bitmap, const uint8_t *const unpacked, const int x, const int y) {
+    const int row_bytes = (bitmap->width + 7) / 8;
+
+    switch (bitmap->format) {
+        case RESOURCE_FORMAT_RAW:
+            return bitmap->data[y * row_bytes + x / 8] & (0x80 >> (x % 8));
+
+        case RESOURCE_FORMAT_PACKBITS:
+            return unpacked[y * row_bytes + x / 8] & (0x80 >> (x % 8));
+
+        case RESOURCE_FORMAT_PAGES:
+            // lcd_framebuffer_compose has no room for the columns past the LCD's width
+            return x < LCD_WIDTH && bitmap->data[(y / 8) * bitmap->width + x] & (1 << (y % 8));
+    }
+
+    return false;
+}
+
+void host_decode_bitmap(const resource_bitmap_t *const bitmap, uint8_t *const pixels, const uint16_t row_length) {
+    // the largest bitmap there can be, truncated data is left black like lcd_framebuffer_compose does
+    uint8_t unpacked[(UINT8_MAX + 7) / 8 * UINT8_MAX];
+
+    memset(unpacked, 0, sizeof(unpacked));
+
+    if (bitmap->format == RESOURCE_FORMAT_PACKBITS) {
+        const uint8_t *data = bitmap->data;
+        const uint8_t *const end = bitmap->data + bitmap->size;
+        size_t length = 0;
+
+        while (data < end && length < sizeof(unpacked)) {
+            const uint8_t header = *data++;
+
+            if (header < 128) {
+                for (int i = 0; i <= header && data < end && length < sizeof(unpacked); i++) unpacked[length++] = *data++;
+            } else if (header > 128 && data < end) {
+                for (int i = 0; i < 257 - header && length < sizeof(unpacked); i++) unpacked[length++] = *data;
+                data++;
+            }
+        }
+    }
+
+    for (int y = 0; y < bitmap->height; y++) {
+        for (int x = 0; x < bitmap->width; x++) pixels[y * row_length + x] = get_bitmap_pixel(bitmap, unpacked, x, y);
+    }
+}
+
+bool host_write_pbm(const char *const path, const host_frame_t *const frames, const uint16_t num_frames) {
+    FILE *const file = fopen(path, "wb");
+    if (file == NULL) return false;
+
+    fprintf(file, "P4\n%d %d\n", HOST_DISPLAY_WIDTH, HOST_DISPLAY_HEIGHT * num_frames);
+
+    // 8 pixels per byte, the first one in the most significant bit, a set bit being black
+    for (uint16_t frame = 0; frame < num_frames; frame++) {
+        for (uint8_t y = 0; y < HOST_DISPLAY_HEIGHT; y++) {
+            for (uint8_t x = 0; x < HOST_DISPLAY_WIDTH; x += 8) {
+                uint8_t byte = 0;
+
+                for (uint8_t bit = 0; bit < 8; bit++) byte |= (frames[frame][y][x + bit] ? 0 : 0x80) >> bit;
+
+                fputc(byte, file);
+            }
+        }
+    }
+
+    return fclose(file) == 0;
+}
+
+// the next number of the header, skipping white space and comments
+static int read_pbm_number(FILE *const file) {
+    int character = fgetc(file);
+
+    while (isspace(character) || character == '#') {
+        if (character == '#') {
+            while (character != '\n' && character != EOF) character = fgetc(file);
+        }
+
+        character = fgetc(file);
+    }
+
+    int number = 0;
+    if (!isdigit(character)) return -1;
+
+    for (; isdigit(character); character = fgetc(file)) number = number * 10 + character - '0';
+
+    // the single white space character after the height ends the header
+    return number;
+}
+
+int host_read_pbm(const char *const path, host_frame_t *const frames, const uint16_t max_frames) {
+    FILE *const file = fopen(path, "rb");
+    if (file == NULL) return -1;
+
+    const bool is_pbm = fgetc(file) == 'P' && fgetc(file) == '4';
+    const int width = is_pbm ? read_pbm_number(file) : -1;
+    const int height = is_pbm ? read_pbm_number(file) : -1;
+    const int num_frames = height / HOST_DISPLAY_HEIGHT;
+
+    if (width != HOST_DISPLAY_WIDTH || height <= 0 || height % HOST_DISPLAY_HEIGHT != 0 || num_frames > max_frames) {
+        fclose(file);
+        return -1;
+    }
+
+    for (int frame = 0; frame < num_frames; frame++) {
+        for (uint8_t y = 0; y < HOST_DISPLAY_HEIGHT; y++) {
+            for (uint8_t x = 0; x < HOST_DISPLAY_WIDTH; x += 8) {
+                const int byte = fgetc(file);
+
+                if (byte == EOF) {
+                    fclose(file);
+                    return -1;
+                }
+
+                for (uint8_t bit = 0; bit < 8; bit++) frames[frame][y][x + bit] = !(byte & (0x80 >> bit));
+            }
+        }
+    }
+
+    fclose(file);
+
+    return num_frames;
+}
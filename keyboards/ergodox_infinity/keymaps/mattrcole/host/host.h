@@ -0,0 +1,162 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "gfx.h"
+#include "action_layer.h"
+#include "layers.h"
+#include "resources/resources.h"
+
+/**
+ * The host build of the visualizer and this keymap.
+ *
+ * mock-gfx.c stands in for uGFX and ChibiOS. Nothing happens on its own:
+ * the harness scans the keyboard and runs the visualizer threads up to a
+ * virtual time, a millisecond per tick. A keyboard has up to two halves,
+ * each with its own clock, display and visualizer thread. The half that is
+ * selected is the one gfxSystemTicks(), GDISP and gdispGetDisplay() answer
+ * for, a visualizer thread always runs as its own half.
+*/
+
+#define HOST_MAX_HALVES 2
+#define HOST_FRAME_BYTES (HOST_DISPLAY_WIDTH * HOST_DISPLAY_HEIGHT / 8)
+
+typedef uint8_t host_frame_t[HOST_DISPLAY_HEIGHT][HOST_DISPLAY_WIDTH];
+
+/**
+ * host_counters_t
+ *
+ * What reached a half's display driver and its visualizer thread.
+ *
+ * blits, fills: gdispGBlitArea, gdispGFillArea and gdispGClear calls
+ * blit_bytes: source bytes the blits read, a row at a time
+ * flushes: gdispGFlush calls that sent a frame to the LCD
+ * spi_bytes: what those frames cost on the bus
+ * wakeups: passes of the visualizer thread's loop
+ * run_time, max_run_time: host CPU time, in ns, the visualizer thread ran
+ *      for in total and at most before it waited again
+ * link_frames, link_bytes: what the half sent over the serial link, the
+ *      bytes with HOST_LINK_FRAME_OVERHEAD, dropped frames included
+*/
+typedef struct {
+    uint32_t blits;
+    uint32_t blit_pixels;
+    uint32_t blit_bytes;
+    uint32_t fills;
+    uint32_t fill_pixels;
+    uint32_t flushes;
+    uint32_t spi_bytes;
+    uint32_t wakeups;
+    uint64_t run_time;
+    uint32_t max_run_time;
+    uint32_t link_frames;
+    uint32_t link_bytes;
+} host_counters_t;
+
+/**
+ * What the serial link adds to every object it sends: the index of the
+ * object, the destination, a CRC32 and the framing of the byte stuffer.
+*/
+#define HOST_LINK_FRAME_OVERHEAD 8
+
+// Returned by the link hook to drop a frame
+#define HOST_LINK_DROP ((systemticks_t)-1)
+
+// The virtual time, in ticks of the first half
+systemticks_t host_get_time(void);
+
+void host_select_half(const uint8_t half);
+uint8_t host_get_half(void);
+
+// Makes the clock of a half run ahead of the virtual time by offset ticks
+void host_set_clock_offset(const uint8_t half, const systemticks_t offset);
+
+/**
+ * Runs the visualizer threads that are due until the virtual time reaches
+ * time, in the order they are due, and then moves it to time. Threads that
+ * are due at the same tick run in the order they were created.
+*/
+void host_run_until(const systemticks_t time);
+
+// true if the visualizer thread of the half waits for an event, without a timeout
+bool host_is_idle(const uint8_t half);
+
+/**
+ * Called whenever a visualizer thread is about to wake up, the thread then
+ * wakes up the returned amount of ticks later instead, like it would when
+ * the matrix scan or USB kept the CPU busy. At most once per wakeup.
+*/
+void host_set_stall_hook(systemticks_t (*hook)(const uint8_t half));
+
+// Called after every pass of a visualizer thread's loop
+void host_set_wakeup_hook(void (*hook)(const uint8_t half));
+
+// Called for every frame sent to the LCD of a half
+void host_set_flush_hook(void (*hook)(const uint8_t half, const host_frame_t frame));
+
+/**
+ * Called for every frame the master sends over the serial link, returns the
+ * ticks it takes to arrive or HOST_LINK_DROP. Without a hook, frames arrive
+ * a tick later. Either way they arrive in the order they were sent.
+*/
+void host_set_link_hook(systemticks_t (*hook)(const uint8_t object));
+
+host_counters_t *host_get_counters(const uint8_t half);
+void host_reset_counters(void);
+
+// What the LCD of the half shows, 1 for a white pixel
+const host_frame_t *host_get_lcd(const uint8_t half);
+
+// gdispOpenFont calls since the start
+uint32_t host_get_font_opens(void);
+
+// The backlight color last set on the selected half, as an LCD_COLOR
+uint32_t host_get_backlight_color(void);
+
+// The layer_state_t that makes layer the top one, the way TO() leaves it
+layer_state_t host_layer_state(const Layers layer);
+
+/**
+ * What the keyboard's main loop does with the visualizer on every matrix
+ * scan. host_scan_until scans the selected half once per tick and runs
+ * the visualizer threads in between.
+*/
+void host_scan(const layer_state_t layers);
+void host_scan_until(const layer_state_t layers, const systemticks_t time);
+
+/**
+ * Scans with layers until the visualizer of the selected half is idle
+ * again, and returns how long that took. Gives up, failing the run, after
+ * limit ticks.
+*/
+systemticks_t host_settle(const layer_state_t layers, const systemticks_t limit);
+
+// Starts the visualizer of the selected half, and settles on layer
+void host_boot(const Layers layer);
+
+// The lower case names used for the layers in file names and reports
+const char *host_layer_name(const Layers layer);
+
+/**
+ * Decodes a bitmap of any resource_format_t one pixel at a time, the slow
+ * and obvious way, to check the drawing code against. pixels gets a byte
+ * per pixel, 1 for a set bit, rows being row_length bytes apart. The columns
+ * of a PAGES bitmap past LCD_WIDTH are left black, like lcd_framebuffer_compose
+ * does.
+*/
+void host_decode_bitmap(const resource_bitmap_t *const bitmap, uint8_t *const pixels, const uint16_t row_length);
+
+/**
+ * Writes frames, stacked from top to bottom, as a binary PBM image.
+ * Returns false if the file couldn't be written.
+*/
+bool host_write_pbm(const char *const path, const host_frame_t *const frames, const uint16_t num_frames);
+
+/**
+ * Reads a PBM image of stacked frames, as written by host_write_pbm, into
+ * frames. Returns how many there were, or -1 if the file couldn't be read,
+ * isn't a binary PBM or holds more than max_frames.
+*/
+int host_read_pbm(const char *const path, host_frame_t *const frames, const uint16_t max_frames);
+
+// Prints the message to stderr and exits with a failure
+void host_fail(const char *const format, ...) __attribute__((format(printf, 1, 2), noreturn));
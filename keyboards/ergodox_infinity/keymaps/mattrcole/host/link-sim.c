@@ -0,0 +1,310 @@
+/**
+ * Both halves of the keyboard, connected by the serial link of
+ * mock-serial-link.c, and what the visualizer status costs that link.
+ *
+ * Each half runs a copy of its own of keymap.c, the visualizer and this
+ * keymap, built with SERIAL_LINK_ENABLE. The Makefile links each copy into
+ * one object, with everything but what's declared below made local and that
+ * prefixed with master_ or slave_. Both halves are scanned every tick, the
+ * master with the keys of the trace and the slave with nothing pressed, like
+ * on the keyboard. Frames take 1 to 4 ms to arrive, and the slave's clock is
+ * far apart from the master's.
+ *
+ * typing: a key every 150 ms, one in eight of them shifted, and caps lock
+ *      turned on for 3 s every 20 s
+ * layers: FN held for 200 ms every 500 ms, and a TO() to the next of WIN,
+ *      MAC, GAM and COD every 3 s
+ *
+ * For every trace, what the master sent over the link per second, and what
+ * the transport before the status parts would have sent for the same trace:
+ * the whole visualizer_keyboard_status_t whenever it changed and at least
+ * every 10 ms, with the same frame overhead. The user data follows the
+ * layers in this keymap, so a change of the layers counts for it.
+ *
+ * Also the longest the slave's status differed from the master's, the
+ * slave's being the whole generation it last received. After each trace,
+ * the slave has to come to the master's status and show the same on its LCD
+ * within SETTLE_LIMIT, or the run fails.
+ *
+ * And how far apart the LCDs are, the skew: every frame the slave sends to
+ * its LCD is matched with the same frame on the master's, the one closest
+ * in time, and the skew is how much later the slave showed it. A frame the
+ * master didn't show within its last MASTER_FRAMES frames and MATCH_WINDOW
+ * is counted as the slave's own. Against that, the arrival: how long after
+ * the master's top layer changed the slave's did, which is when the slave
+ * started its animation before the halves shared their clock.
+ *
+ * link-sim [drop percent] [seed]: the traces run once without dropping
+ * frames and once dropping that share of them, 5 and 1 by default
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+#include "visualizer.h"
+
+#define TRACE_LENGTH 60000
+// The frames of the master the slave's are matched with, at most MATCH_WINDOW apart
+#define MASTER_FRAMES 64
+#define MATCH_WINDOW 1000
+#define SETTLE_LIMIT 3000
+// what the slave's clock is ahead of the master's
+#define SLAVE_CLOCK_OFFSET 123456
+
+#define LEFT_SHIFT 0x02
+#define CAPS_LOCK_LED 0x02
+
+void master_visualizer_init(void);
+void master_visualizer_update(layer_state_t default_state, layer_state_t state, uint8_t mods, uint32_t leds);
+void master_matrix_scan_user(void);
+extern layer_state_t master_layer_state;
+extern visualizer_keyboard_status_t master_current_status;
+
+void slave_visualizer_init(void);
+void slave_visualizer_update(layer_state_t default_state, layer_state_t state, uint8_t mods, uint32_t leds);
+void slave_matrix_scan_user(void);
+extern layer_state_t slave_layer_state;
+extern visualizer_keyboard_status_t slave_current_status;
+
+typedef struct {
+    layer_state_t layers;
+    uint8_t       mods;
+    uint32_t      leds;
+} keys_t;
+
+typedef keys_t (*trace_t)(const systemticks_t time);
+
+static const layer_state_t default_layers = (layer_state_t)1 << WIN_LAYOUT;
+
+static uint32_t random_state;
+static unsigned drop_percent;
+
+// xorshift32, so that a seed gives the same run everywhere
+static uint32_t random_below(const uint32_t limit) {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+
+    return random_state % limit;
+}
+
+static systemticks_t link_latency(const uint8_t object) { return random_below(100) < drop_percent ? HOST_LINK_DROP : 1 + random_below(4); }
+
+// What the old transport sent: the whole status on every change, and otherwise after more than 10 ms
+static uint32_t old_link_bytes;
+
+static void count_old_link_bytes(const keys_t *const keys) {
+    static keys_t sent_keys;
+    static systemticks_t last_update = 0;
+    const bool changed = keys->layers != sent_keys.layers || keys->mods != sent_keys.mods || keys->leds != sent_keys.leds;
+
+    if (changed || host_get_time() - last_update > 10) {
+        sent_keys = *keys;
+        last_update = host_get_time();
+        old_link_bytes += sizeof(visualizer_keyboard_status_t) + HOST_LINK_FRAME_OVERHEAD;
+    }
+}
+
+typedef struct {
+    uint32_t count;
+    int64_t  sum;
+    int32_t  max;
+} samples_t;
+
+static void add_sample(samples_t *const samples, const int32_t sample) {
+    if (samples->count == 0 || sample > samples->max) samples->max = sample;
+
+    samples->count++;
+    samples->sum += sample;
+}
+
+static double get_mean(const samples_t *const samples) { return samples->count > 0 ? (double)samples->sum / samples->count : 0; }
+
+static struct {
+    systemticks_t time;
+    host_frame_t  frame;
+} master_frames[MASTER_FRAMES];
+static uint8_t num_master_frames;
+static uint8_t next_master_frame;
+
+static samples_t skew;
+static samples_t arrival;
+static uint32_t slave_only_frames;
+
+static void match_frame(const uint8_t half, const host_frame_t frame) {
+    if (half == 0) {
+        master_frames[next_master_frame].time = host_get_time();
+        memcpy(master_frames[next_master_frame].frame, frame, sizeof(host_frame_t));
+        next_master_frame = (next_master_frame + 1) % MASTER_FRAMES;
+        if (num_master_frames < MASTER_FRAMES) num_master_frames++;
+        return;
+    }
+
+    bool matched = false;
+    int32_t closest = 0;
+
+    for (uint8_t i = 0; i < num_master_frames; i++) {
+        const int32_t later = host_get_time() - master_frames[i].time;
+
+        if (abs(later) > MATCH_WINDOW || memcmp(master_frames[i].frame, frame, sizeof(host_frame_t)) != 0) continue;
+        if (matched && abs(later) >= abs(closest)) continue;
+
+        matched = true;
+        closest = later;
+    }
+
+    if (matched) {
+        add_sample(&skew, closest);
+    } else {
+        slave_only_frames++;
+    }
+}
+
+// The matrix scan of both halves, then a tick
+static void scan(const keys_t *const keys) {
+    host_select_half(0);
+    master_layer_state = keys->layers;
+    master_matrix_scan_user();
+    master_visualizer_update(default_layers, keys->layers, keys->mods, keys->leds);
+    count_old_link_bytes(keys);
+
+    host_select_half(1);
+    slave_layer_state = default_layers;
+    slave_matrix_scan_user();
+    slave_visualizer_update(default_layers, default_layers, 0, 0);
+
+    host_select_half(0);
+    host_run_until(host_get_time() + 1);
+}
+
+// biton32() is local to the halves
+static uint8_t get_top_layer(layer_state_t layers) {
+    uint8_t layer = 0;
+
+    while (layers >>= 1) layer++;
+
+    return layer;
+}
+
+static bool statuses_match(void) { return memcmp(&master_current_status, &slave_current_status, sizeof(visualizer_keyboard_status_t)) == 0; }
+
+static bool lcds_match(void) { return memcmp(host_get_lcd(0), host_get_lcd(1), sizeof(host_frame_t)) == 0; }
+
+// Scans with keys until both halves have the same status, are idle and show the same, returns how long that took
+static systemticks_t settle(const keys_t *const keys, const systemticks_t limit) {
+    const systemticks_t start = host_get_time();
+
+    do {
+        if (host_get_time() - start > limit) host_fail("the halves didn't come to show the same within %lu ms", (unsigned long)limit);
+
+        scan(keys);
+    } while (!statuses_match() || !host_is_idle(0) || !host_is_idle(1) || !lcds_match());
+
+    return host_get_time() - start;
+}
+
+static keys_t typing(const systemticks_t time) {
+    static systemticks_t shift_until = 0;
+    const systemticks_t key_time = time % 150;
+    keys_t keys = { .layers = default_layers, .mods = 0, .leds = time % 20000 < 3000 ? CAPS_LOCK_LED : 0 };
+
+    // shift goes down 30 ms before the key and comes back up 40 ms after it
+    if (key_time == 120 && random_below(8) == 0) shift_until = time + 70;
+    if ((int32_t)(shift_until - time) > 0) keys.mods = LEFT_SHIFT;
+
+    return keys;
+}
+
+static keys_t switching_layers(const systemticks_t time) {
+    static const Layers base_layers[] = { WIN_LAYOUT, MAC_LAYOUT, GAM_LAYOUT, COD_LAYOUT };
+    const Layers base = base_layers[(time / 3000) % (sizeof(base_layers) / sizeof(base_layers[0]))];
+    keys_t keys = { .layers = (layer_state_t)1 << base, .mods = 0, .leds = 0 };
+
+    if (time % 500 < 200) keys.layers |= (layer_state_t)1 << FN_LAYER;
+
+    return keys;
+}
+
+static void run_trace(const char *const name, const trace_t trace) {
+    const systemticks_t start = host_get_time();
+    systemticks_t lag_start = start;
+    systemticks_t longest_lag = 0;
+    keys_t keys;
+
+    systemticks_t layer_change = start;
+    bool layers_differ = false;
+
+    host_reset_counters();
+    old_link_bytes = 0;
+    memset(&skew, 0, sizeof(skew));
+    memset(&arrival, 0, sizeof(arrival));
+    slave_only_frames = 0;
+
+    for (systemticks_t t = 0; t < TRACE_LENGTH; t++) {
+        keys = trace(t);
+        scan(&keys);
+
+        if (statuses_match()) {
+            lag_start = host_get_time();
+        } else if (host_get_time() - lag_start > longest_lag) {
+            longest_lag = host_get_time() - lag_start;
+        }
+
+        const bool top_layers_differ = get_top_layer(master_current_status.layer) != get_top_layer(slave_current_status.layer);
+
+        if (top_layers_differ && !layers_differ) layer_change = host_get_time();
+        if (!top_layers_differ && layers_differ) add_sample(&arrival, host_get_time() - layer_change);
+        layers_differ = top_layers_differ;
+    }
+
+    const host_counters_t *const counters = host_get_counters(0);
+    const systemticks_t settled = settle(&keys, SETTLE_LIMIT);
+
+    printf("%-8s %9lu %9lu %9lu | %7lu %10lu | %7lu %5.2f %4ld %6lu | %5.2f %4ld\n", name,
+        (unsigned long)(counters->link_frames * 1000ull / TRACE_LENGTH),
+        (unsigned long)(counters->link_bytes * 1000ull / TRACE_LENGTH),
+        (unsigned long)(old_link_bytes * 1000ull / TRACE_LENGTH),
+        (unsigned long)longest_lag, (unsigned long)settled,
+        (unsigned long)skew.count, get_mean(&skew), (long)skew.max, (unsigned long)slave_only_frames,
+        get_mean(&arrival), (long)arrival.max);
+}
+
+static void run_traces(const unsigned drops) {
+    drop_percent = drops;
+
+    printf("%u%% of the frames dropped\n", drops);
+    printf("%-8s %9s %9s %9s | %7s %10s | %7s %10s %6s | %10s\n", "", "frames/s", "B/s", "old B/s", "lag ms", "settle ms",
+        "frames", "skew ms", "own", "arrival ms");
+
+    run_trace("typing", typing);
+    run_trace("layers", switching_layers);
+}
+
+int main(int argc, char **argv) {
+    const int drops = argc > 1 ? atoi(argv[1]) : 5;
+    const uint32_t seed = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 0) : 1;
+
+    if (drops < 0 || drops > 100 || seed == 0) host_fail("usage: %s [drop percent] [seed]", argv[0]);
+
+    random_state = seed;
+    host_set_link_hook(link_latency);
+    host_set_flush_hook(match_frame);
+    host_set_clock_offset(1, SLAVE_CLOCK_OFFSET);
+
+    host_select_half(0);
+    master_visualizer_init();
+    host_select_half(1);
+    slave_visualizer_init();
+    host_select_half(0);
+
+    // the startup animation takes 5 s, then the first layer slides in
+    const keys_t resting = { .layers = default_layers, .mods = 0, .leds = 0 };
+    settle(&resting, 10000);
+
+    run_traces(0);
+    run_traces(drops);
+
+    return EXIT_SUCCESS;
+}
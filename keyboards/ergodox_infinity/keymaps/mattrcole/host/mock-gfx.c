@@ -0,0 +1,404 @@
+/**
+ * uGFX and the ChibiOS threads, as far as the visualizer uses them, for the
+ * host build. See host.h.
+ *
+ * Each visualizer thread is a coroutine with a stack of its own. It runs
+ * until it waits for an event in geventEventWait(), which switches back to
+ * host_run_until(). The time doesn't move while a thread runs, so the
+ * frames only depend on when the harness scans and what it sends, not on
+ * how fast the host is. What the code costs is measured with
+ * host_cpu_clock() instead, which VISUALIZER_STATS_CLOCK() is set to.
+ *
+ * An event sent to a thread that isn't waiting is kept, like the semaphore
+ * of a uGFX listener, and its next wait returns at once.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <ucontext.h>
+
+#include "host.h"
+
+#define HOST_MAX_THREADS HOST_MAX_HALVES
+#define HOST_THREAD_STACK_SIZE (256 * 1024)
+
+// A thread that keeps asking to be woken up right away is stuck
+#define HOST_MAX_IMMEDIATE_WAKEUPS 10000
+
+struct host_thread {
+    ucontext_t     context;
+    threadreturn_t (*function)(void*);
+    void*          param;
+    uint8_t        half;
+    bool           waiting;
+    bool           waiting_forever;
+    bool           event_pending;
+    bool           stalled;
+    systemticks_t  wake_time;   // virtual time, while waiting and not forever
+    uint16_t       immediate_wakeups;
+};
+
+static struct host_thread threads[HOST_MAX_THREADS];
+static uint8_t            num_threads = 0;
+static struct host_thread *running_thread = NULL;
+static ucontext_t         scheduler_context;
+
+static systemticks_t now = 0;
+static systemticks_t clock_offsets[HOST_MAX_HALVES];
+static uint8_t       selected_half = 0;
+
+static GDisplay        displays[HOST_MAX_HALVES];
+static host_counters_t counters[HOST_MAX_HALVES];
+static uint32_t        font_opens = 0;
+
+static systemticks_t (*stall_hook)(const uint8_t half) = NULL;
+static void (*wakeup_hook)(const uint8_t half) = NULL;
+static void (*flush_hook)(const uint8_t half, const host_frame_t frame) = NULL;
+
+void host_fail(const char *const format, ...) {
+    va_list arguments;
+
+    va_start(arguments, format);
+    fprintf(stderr, "FAIL at %lu ms: ", (unsigned long)now);
+    vfprintf(stderr, format, arguments);
+    fputc('\n', stderr);
+    va_end(arguments);
+
+    exit(EXIT_FAILURE);
+}
+
+systemticks_t host_get_time(void) { return now; }
+
+void host_select_half(const uint8_t half) {
+    if (half >= HOST_MAX_HALVES) host_fail("there is no half %u", half);
+
+    selected_half = half;
+}
+
+uint8_t host_get_half(void) { return selected_half; }
+
+void host_set_clock_offset(const uint8_t half, const systemticks_t offset) { clock_offsets[half] = offset; }
+
+void host_set_stall_hook(systemticks_t (*hook)(const uint8_t half)) { stall_hook = hook; }
+
+void host_set_wakeup_hook(void (*hook)(const uint8_t half)) { wakeup_hook = hook; }
+
+void host_set_flush_hook(void (*hook)(const uint8_t half, const host_frame_t frame)) { flush_hook = hook; }
+
+host_counters_t *host_get_counters(const uint8_t half) { return &counters[half]; }
+
+void host_reset_counters(void) { memset(counters, 0, sizeof(counters)); }
+
+const host_frame_t *host_get_lcd(const uint8_t half) { return &displays[half].lcd; }
+
+uint32_t host_get_font_opens(void) { return font_opens; }
+
+uint32_t host_cpu_clock(void) {
+    struct timespec time;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+
+    // wraps around every few seconds, only differences are ever used
+    return (uint32_t)((uint64_t)time.tv_sec * 1000000000u + (uint64_t)time.tv_nsec);
+}
+
+// THREADS START =================================================================================================================
+
+systemticks_t gfxSystemTicks(void) { return now + clock_offsets[selected_half]; }
+
+static void switch_to_thread(struct host_thread *const thread) {
+    const uint8_t half = selected_half;
+
+    running_thread = thread;
+    selected_half = thread->half;
+    thread->waiting = false;
+    thread->stalled = false;
+
+    swapcontext(&scheduler_context, &thread->context);
+
+    running_thread = NULL;
+    selected_half = half;
+}
+
+// Switches back to host_run_until until the thread is woken up, returns true for an event
+static bool wait_in_thread(struct host_thread *const thread, const delaytime_t timeout) {
+    thread->waiting = true;
+    thread->waiting_forever = timeout == TIME_INFINITE;
+    thread->wake_time = now + timeout;
+
+    swapcontext(&thread->context, &scheduler_context);
+
+    const bool event = thread->event_pending;
+    thread->event_pending = false;
+
+    return event;
+}
+
+void gfxSleepMilliseconds(delaytime_t ms) {
+    if (running_thread == NULL) {
+        host_run_until(now + ms);
+        return;
+    }
+
+    struct host_thread *const thread = running_thread;
+    const systemticks_t end = now + ms;
+    bool event = false;
+
+    // an event doesn't end a sleep, it's left for the next wait
+    while ((int32_t)(end - now) > 0) event |= wait_in_thread(thread, end - now);
+
+    thread->event_pending |= event;
+}
+
+static void run_thread(void) {
+    running_thread->function(running_thread->param);
+
+    host_fail("a visualizer thread returned");
+}
+
+void gfxInit(void) {}
+
+gfxThreadHandle gfxThreadCreate(void* stack, size_t stack_size, threadpriority_t priority, threadreturn_t (*function)(void*), void* param) {
+    (void)stack;
+    (void)stack_size;
+    (void)priority;
+
+    if (num_threads == HOST_MAX_THREADS) host_fail("too many threads");
+
+    struct host_thread *const thread = &threads[num_threads++];
+
+    // the stacks of the board are far too small for host code
+    getcontext(&thread->context);
+    thread->context.uc_stack.ss_sp = malloc(HOST_THREAD_STACK_SIZE);
+    thread->context.uc_stack.ss_size = HOST_THREAD_STACK_SIZE;
+    thread->context.uc_link = NULL;
+    makecontext(&thread->context, run_thread, 0);
+
+    thread->function = function;
+    thread->param = param;
+    thread->half = selected_half;
+    // it starts as soon as the caller gives up the CPU
+    thread->waiting = true;
+    thread->waiting_forever = false;
+    thread->wake_time = now;
+
+    return thread;
+}
+
+static bool is_due(const struct host_thread *const thread, const systemticks_t time) {
+    if (!thread->waiting) return false;
+
+    if (thread->stalled) return thread->wake_time <= time;
+
+    return thread->event_pending || (!thread->waiting_forever && thread->wake_time <= time);
+}
+
+static systemticks_t get_due_time(const struct host_thread *const thread) {
+    if (thread->event_pending && !thread->stalled) return now;
+
+    return thread->wake_time < now ? now : thread->wake_time;
+}
+
+void host_run_until(const systemticks_t time) {
+    if (running_thread != NULL) host_fail("host_run_until called from a visualizer thread");
+
+    while (true) {
+        struct host_thread *next = NULL;
+
+        for (uint8_t i = 0; i < num_threads; i++) {
+            if (!is_due(&threads[i], time)) continue;
+
+            if (next == NULL || get_due_time(&threads[i]) < get_due_time(next)) next = &threads[i];
+        }
+
+        if (next == NULL) break;
+
+        now = get_due_time(next);
+
+        if (stall_hook != NULL && !next->stalled) {
+            const systemticks_t stall = stall_hook(next->half);
+
+            if (stall > 0) {
+                next->stalled = true;
+                next->wake_time = now + stall;
+                continue;
+            }
+        }
+
+        const uint32_t start = host_cpu_clock();
+        const uint8_t half = next->half;
+
+        switch_to_thread(next);
+
+        const uint32_t run_time = host_cpu_clock() - start;
+        counters[half].run_time += run_time;
+        if (run_time > counters[half].max_run_time) counters[half].max_run_time = run_time;
+    }
+
+    if ((int32_t)(time - now) > 0) now = time;
+}
+
+bool host_is_idle(const uint8_t half) {
+    for (uint8_t i = 0; i < num_threads; i++) {
+        const struct host_thread *const thread = &threads[i];
+
+        if (thread->half != half) continue;
+
+        return thread->waiting && thread->waiting_forever && !thread->event_pending && !thread->stalled;
+    }
+
+    return true;
+}
+
+// THREADS STOP ==================================================================================================================
+
+// EVENTS START ==================================================================================================================
+
+// There's only ever a single source, the status of the half
+static GSourceListener source_listeners[HOST_MAX_HALVES];
+
+void geventListenerInit(GListener* listener) { listener->thread = running_thread; }
+
+bool geventAttachSource(GListener* listener, GSourceHandle source, unsigned flags) {
+    (void)flags;
+
+    GSourceListener *const source_listener = &source_listeners[listener->thread->half];
+    source_listener->source = source;
+    source_listener->listener = listener;
+
+    return true;
+}
+
+GSourceListener* geventGetSourceListener(GSourceHandle source, GSourceListener* last) {
+    GSourceListener *const source_listener = &source_listeners[selected_half];
+
+    if (last != NULL || source_listener->listener == NULL || source_listener->source != source) return NULL;
+
+    return source_listener;
+}
+
+void geventSendEvent(GSourceListener* source_listener) { source_listener->listener->thread->event_pending = true; }
+
+void* geventEventWait(GListener* listener, delaytime_t timeout) {
+    struct host_thread *const thread = listener->thread;
+
+    counters[thread->half].wakeups++;
+    if (wakeup_hook != NULL) wakeup_hook(thread->half);
+
+    if (thread->event_pending || timeout == 0) {
+        if (++thread->immediate_wakeups > HOST_MAX_IMMEDIATE_WAKEUPS) host_fail("the visualizer of half %u never sleeps", thread->half);
+
+        const bool event = thread->event_pending;
+        thread->event_pending = false;
+
+        return event ? listener : NULL;
+    }
+
+    thread->immediate_wakeups = 0;
+
+    return wait_in_thread(thread, timeout) ? listener : NULL;
+}
+
+// EVENTS STOP ===================================================================================================================
+
+// DISPLAY START =================================================================================================================
+
+GDisplay* host_get_display(void) { return &displays[selected_half]; }
+
+GDisplay* gdispGetDisplay(unsigned display) {
+    (void)display;
+
+    return &displays[selected_half];
+}
+
+static host_counters_t *get_display_counters(const GDisplay *const g) { return &counters[g - displays]; }
+
+static void set_pixel(GDisplay *const g, const int16_t x, const int16_t y, const uint8_t white) {
+    if (x < 0 || x >= HOST_DISPLAY_WIDTH || y < 0 || y >= HOST_DISPLAY_HEIGHT) return;
+
+    g->ram[y][x] = white;
+}
+
+void gdispGBlitArea(GDisplay* g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel* buffer) {
+    // the bitmaps of this keyboard are handed over packed, 8 pixels per byte
+    const uint8_t *const bytes = (const uint8_t*)buffer;
+    const uint16_t row_bytes = (srccx + 7) / 8;
+    host_counters_t *const display_counters = get_display_counters(g);
+
+    for (gCoord row = 0; row < cy; row++) {
+        for (gCoord column = 0; column < cx; column++) {
+            const uint16_t source_x = srcx + column;
+            const uint8_t byte = bytes[(srcy + row) * row_bytes + source_x / 8];
+
+            set_pixel(g, x + column, y + row, (byte >> (7 - source_x % 8)) & 1);
+        }
+    }
+
+    g->needs_flush = true;
+    display_counters->blits++;
+    display_counters->blit_pixels += cx * cy;
+    display_counters->blit_bytes += ((srcx + cx - 1) / 8 - srcx / 8 + 1) * cy;
+}
+
+void gdispGFillArea(GDisplay* g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor color) {
+    host_counters_t *const display_counters = get_display_counters(g);
+
+    for (gCoord row = 0; row < cy; row++) {
+        for (gCoord column = 0; column < cx; column++) set_pixel(g, x + column, y + row, color != Black);
+    }
+
+    g->needs_flush = true;
+    display_counters->fills++;
+    display_counters->fill_pixels += cx * cy;
+}
+
+void gdispGClear(GDisplay* g, gColor color) { gdispGFillArea(g, 0, 0, HOST_DISPLAY_WIDTH, HOST_DISPLAY_HEIGHT, color); }
+
+void gdispGFlush(GDisplay* g) {
+    // like the ST7565 driver, which sends every page of its buffer
+    if (!g->needs_flush) return;
+
+    host_counters_t *const display_counters = get_display_counters(g);
+
+    memcpy(g->lcd, g->ram, sizeof(g->lcd));
+    g->needs_flush = false;
+    display_counters->flushes++;
+    display_counters->spi_bytes += HOST_FRAME_BYTES;
+
+    if (flush_hook != NULL) flush_hook(g - displays, g->lcd);
+}
+
+void gdispGSetPowerMode(GDisplay* g, gPowermode mode) { g->powered = mode == powerOn; }
+
+void gdispGSetBacklight(GDisplay* g, unsigned percent) {
+    (void)g;
+    (void)percent;
+}
+
+struct host_font {
+    const char *name;
+};
+
+gFont gdispOpenFont(const char* name) {
+    static struct host_font fonts[8];
+    static uint8_t num_fonts = 0;
+
+    font_opens++;
+
+    for (uint8_t i = 0; i < num_fonts; i++) {
+        if (strcmp(fonts[i].name, name) == 0) return &fonts[i];
+    }
+
+    if (num_fonts == sizeof(fonts) / sizeof(fonts[0])) host_fail("too many fonts");
+
+    fonts[num_fonts].name = name;
+
+    return &fonts[num_fonts++];
+}
+
+void gdispCloseFont(gFont font) { (void)font; }
+
+// DISPLAY STOP ==================================================================================================================
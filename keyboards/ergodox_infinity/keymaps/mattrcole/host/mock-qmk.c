@@ -0,0 +1,157 @@
+/**
+ * The parts of QMK around the visualizer, for the host build. The keyframes
+ * and the startup animation do the same as the ones in quantum/visualizer,
+ * except that the logo is a plain frame, the image isn't part of this tree.
+*/
+
+#include <stdlib.h>
+
+#include "host.h"
+#include "visualizer.h"
+#include "visualizer_keyframes.h"
+#include "lcd_keyframes.h"
+#include "lcd_backlight_keyframes.h"
+#include "default_animations.h"
+#include "action_util.h"
+#include "util.h"
+#include "ergodox_infinity.h"
+
+layer_state_t layer_state = 0;
+layer_state_t default_layer_state = 0;
+
+static uint32_t backlight_colors[HOST_MAX_HALVES];
+
+void eeconfig_init(void) {}
+
+void send_string(const char *str) { (void)str; }
+
+uint8_t get_mods(void) { return 0; }
+
+uint8_t get_oneshot_mods(void) { return 0; }
+
+bool has_oneshot_mods_timed_out(void) { return true; }
+
+uint8_t biton32(uint32_t bits) {
+    uint8_t n = 0;
+
+    while (bits >>= 1) n++;
+
+    return n;
+}
+
+void lcd_backlight_init(void) {}
+
+void lcd_backlight_color(uint8_t hue, uint8_t saturation, uint8_t intensity) { backlight_colors[host_get_half()] = LCD_COLOR((uint32_t)hue, (uint32_t)saturation, (uint32_t)intensity); }
+
+void lcd_backlight_brightness(uint8_t b) { (void)b; }
+
+uint32_t host_get_backlight_color(void) { return backlight_colors[host_get_half()]; }
+
+bool keyframe_no_operation(keyframe_animation_t* animation, visualizer_state_t* state) {
+    (void)animation;
+    (void)state;
+
+    return false;
+}
+
+bool lcd_keyframe_draw_logo(keyframe_animation_t* animation, visualizer_state_t* state) {
+    (void)animation;
+    (void)state;
+
+    gdispClear(Black);
+    gdispGFillArea(GDISP, 1, 1, LCD_WIDTH - 2, LCD_HEIGHT - 2, White);
+
+    return false;
+}
+
+bool lcd_keyframe_enable(keyframe_animation_t* animation, visualizer_state_t* state) {
+    (void)animation;
+    (void)state;
+
+    gdispSetPowerMode(powerOn);
+
+    return false;
+}
+
+bool lcd_keyframe_disable(keyframe_animation_t* animation, visualizer_state_t* state) {
+    (void)animation;
+    (void)state;
+
+    gdispSetPowerMode(powerOff);
+
+    return false;
+}
+
+bool lcd_backlight_keyframe_animate_color(keyframe_animation_t* animation, visualizer_state_t* state) {
+    int     frame_length = animation->frame_lengths[animation->current_frame];
+    int     current_pos  = frame_length - animation->time_left_in_frame;
+    uint8_t t_h          = LCD_HUE(state->target_lcd_color);
+    uint8_t t_s          = LCD_SAT(state->target_lcd_color);
+    uint8_t t_i          = LCD_INT(state->target_lcd_color);
+    uint8_t p_h          = LCD_HUE(state->prev_lcd_color);
+    uint8_t p_s          = LCD_SAT(state->prev_lcd_color);
+    uint8_t p_i          = LCD_INT(state->prev_lcd_color);
+
+    uint8_t d_h1 = t_h - p_h;  // Modulo arithmetic since we want to wrap around
+    int     d_h2 = t_h - p_h;
+    // Chose the shortest way around
+    int d_h = abs(d_h2) < d_h1 ? d_h2 : d_h1;
+    int d_s = t_s - p_s;
+    int d_i = t_i - p_i;
+
+    int hue       = (d_h * current_pos) / frame_length;
+    int sat       = (d_s * current_pos) / frame_length;
+    int intensity = (d_i * current_pos) / frame_length;
+    hue += p_h;
+    sat += p_s;
+    intensity += p_i;
+    state->current_lcd_color = LCD_COLOR((uint32_t)hue, (uint32_t)sat, (uint32_t)intensity);
+    lcd_backlight_color(LCD_HUE(state->current_lcd_color), LCD_SAT(state->current_lcd_color), LCD_INT(state->current_lcd_color));
+
+    return true;
+}
+
+bool lcd_backlight_keyframe_enable(keyframe_animation_t* animation, visualizer_state_t* state) {
+    (void)animation;
+
+    lcd_backlight_color(LCD_HUE(state->current_lcd_color), LCD_SAT(state->current_lcd_color), LCD_INT(state->current_lcd_color));
+
+    return false;
+}
+
+bool lcd_backlight_keyframe_disable(keyframe_animation_t* animation, visualizer_state_t* state) {
+    (void)animation;
+    (void)state;
+
+    lcd_backlight_color(0, 0, 0);
+
+    return false;
+}
+
+static bool keyframe_enable(keyframe_animation_t* animation, visualizer_state_t* state) {
+    lcd_keyframe_enable(animation, state);
+    lcd_backlight_keyframe_enable(animation, state);
+
+    return false;
+}
+
+static bool keyframe_disable(keyframe_animation_t* animation, visualizer_state_t* state) {
+    lcd_keyframe_disable(animation, state);
+    lcd_backlight_keyframe_disable(animation, state);
+
+    return false;
+}
+
+keyframe_animation_t default_startup_animation = {
+    .num_frames      = 3,
+    .loop            = false,
+    .frame_lengths   = {0, 0, gfxMillisecondsToTicks(5000)},
+    .frame_functions = {keyframe_enable, lcd_keyframe_draw_logo, lcd_backlight_keyframe_animate_color},
+};
+
+keyframe_animation_t default_suspend_animation = {
+    .num_frames      = 2,
+    .loop            = false,
+    .frame_lengths   = {gfxMillisecondsToTicks(1000), 0},
+    .frame_functions = {lcd_backlight_keyframe_animate_color, keyframe_disable},
+};
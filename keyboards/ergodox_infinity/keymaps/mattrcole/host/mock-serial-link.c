@@ -0,0 +1,120 @@
+/**
+ * The serial link between the halves, for the host build with
+ * SERIAL_LINK_ENABLE. See serial_link/protocol/transport.h.
+ *
+ * The first half is the master, the second one its slave. A frame written
+ * by the master is delivered once the virtual time reaches its arrival, and
+ * a slave reading an object gets the newest frame of it that has arrived,
+ * the older ones are lost like in the triple buffer of the transport.
+*/
+
+#include <string.h>
+
+#include "host.h"
+#include "serial_link/protocol/transport.h"
+#include "serial_link/system/serial_link.h"
+
+#define HOST_LINK_MAX_OBJECTS 8
+#define HOST_LINK_MAX_OBJECT_SIZE 64
+// Frames of an object that can be on their way at once
+#define HOST_LINK_MAX_FRAMES 16
+
+typedef struct {
+    systemticks_t arrival;
+    uint8_t       data[HOST_LINK_MAX_OBJECT_SIZE];
+} host_link_frame_t;
+
+// The frames of an object on their way, the oldest first
+typedef struct {
+    host_link_frame_t frames[HOST_LINK_MAX_FRAMES];
+    uint8_t           first;
+    uint8_t           num_frames;
+} host_link_queue_t;
+
+static remote_object_t   *objects[HOST_MAX_HALVES][HOST_LINK_MAX_OBJECTS];
+static uint8_t           num_objects[HOST_MAX_HALVES];
+static host_link_queue_t queues[HOST_LINK_MAX_OBJECTS];
+static systemticks_t     last_arrival = 0;
+
+static systemticks_t (*link_hook)(const uint8_t object) = NULL;
+
+void host_set_link_hook(systemticks_t (*hook)(const uint8_t object)) { link_hook = hook; }
+
+bool is_serial_link_master(void) { return host_get_half() == 0; }
+
+bool is_serial_link_connected(void) { return host_get_half() != 0; }
+
+void add_remote_objects(remote_object_t** remote_objects, uint32_t num_remote_objects) {
+    const uint8_t half = host_get_half();
+
+    if (num_objects[half] + num_remote_objects > HOST_LINK_MAX_OBJECTS) host_fail("too many remote objects");
+
+    for (uint32_t i = 0; i < num_remote_objects; i++) {
+        if (remote_objects[i]->object_size > HOST_LINK_MAX_OBJECT_SIZE) host_fail("remote object %lu is too large", (unsigned long)i);
+
+        objects[half][num_objects[half]++] = remote_objects[i];
+    }
+}
+
+static bool has_arrived(const host_link_frame_t *const frame) { return (int32_t)(frame->arrival - host_get_time()) <= 0; }
+
+static void pop_frame(host_link_queue_t *const queue) {
+    queue->first = (queue->first + 1) % HOST_LINK_MAX_FRAMES;
+    queue->num_frames--;
+}
+
+// Of the frames that have arrived only the newest one is kept, like in the triple buffer
+static void drop_replaced_frames(host_link_queue_t *const queue) {
+    while (queue->num_frames > 1 && has_arrived(&queue->frames[(queue->first + 1) % HOST_LINK_MAX_FRAMES])) pop_frame(queue);
+}
+
+static uint8_t get_object_index(const remote_object_t *const object) {
+    const uint8_t half = host_get_half();
+
+    for (uint8_t i = 0; i < num_objects[half]; i++) {
+        if (objects[half][i] == object) return i;
+    }
+
+    host_fail("half %u never added the remote object", half);
+}
+
+void host_link_send(remote_object_t* object) {
+    // like the router, a slave doesn't send what the master sends to the slaves
+    if (!is_serial_link_master()) return;
+
+    const uint8_t index = get_object_index(object);
+    host_counters_t *const counters = host_get_counters(host_get_half());
+
+    counters->link_frames++;
+    counters->link_bytes += object->object_size + HOST_LINK_FRAME_OVERHEAD;
+
+    const systemticks_t latency = link_hook != NULL ? link_hook(index) : 1;
+    if (latency == HOST_LINK_DROP) return;
+
+    host_link_queue_t *const queue = &queues[index];
+    drop_replaced_frames(queue);
+    if (queue->num_frames == HOST_LINK_MAX_FRAMES) host_fail("more than %d frames of remote object %u on their way", HOST_LINK_MAX_FRAMES, index);
+
+    // a frame can't overtake the ones before it on the wire
+    systemticks_t arrival = host_get_time() + latency;
+    if ((int32_t)(arrival - last_arrival) < 0) arrival = last_arrival;
+    last_arrival = arrival;
+
+    host_link_frame_t *const frame = &queue->frames[(queue->first + queue->num_frames++) % HOST_LINK_MAX_FRAMES];
+    frame->arrival = arrival;
+    memcpy(frame->data, object->write_buffer, object->object_size);
+}
+
+bool host_link_receive(remote_object_t* object) {
+    if (is_serial_link_master()) return false;
+
+    host_link_queue_t *const queue = &queues[get_object_index(object)];
+
+    drop_replaced_frames(queue);
+    if (queue->num_frames == 0 || !has_arrived(&queue->frames[queue->first])) return false;
+
+    memcpy(object->read_buffer, queue->frames[queue->first].data, object->object_size);
+    pop_frame(queue);
+
+    return true;
+}
@@ -0,0 +1,9 @@
+#pragma once
+#include <stdint.h>
+
+typedef uint32_t layer_state_t;
+
+extern layer_state_t layer_state;
+extern layer_state_t default_layer_state;
+
+layer_state_t layer_state_set_user(layer_state_t state);
@@ -0,0 +1,8 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// No mods are ever held on the host, see mock-qmk.c
+uint8_t get_mods(void);
+uint8_t get_oneshot_mods(void);
+bool has_oneshot_mods_timed_out(void);
@@ -0,0 +1,5 @@
+#pragma once
+
+// What the ErgoDox Infinity's config.h sets for the visualizer
+#define VISUALIZER_USER_DATA_SIZE 16
+#define LED_BRIGHTNESS_HI 255
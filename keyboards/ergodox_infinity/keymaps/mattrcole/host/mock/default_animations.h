@@ -0,0 +1,6 @@
+#pragma once
+#include "visualizer.h"
+
+// Same as in quantum/visualizer/default_animations.c, see mock-qmk.c
+extern keyframe_animation_t default_startup_animation;
+extern keyframe_animation_t default_suspend_animation;
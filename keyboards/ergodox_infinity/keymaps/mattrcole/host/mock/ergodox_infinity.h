@@ -0,0 +1,37 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "action_layer.h"
+#include "util.h"
+
+// What keymap.c uses of QMK_KEYBOARD_H. The layouts are compiled but never
+// looked up, so LAYOUT_ergodox leaves the keys out.
+
+#define MATRIX_ROWS 18
+#define MATRIX_COLS 5
+#define PROGMEM
+#define SAFE_RANGE 0x5F00
+
+#define LAYOUT_ergodox(...) { { 0 } }
+
+typedef struct {
+    struct {
+        bool pressed;
+    } event;
+} keyrecord_t;
+
+void eeconfig_init(void);
+
+void send_string(const char *str);
+#define SEND_STRING(string) send_string(string)
+
+void ergodox_board_led_on(void);
+void ergodox_right_led_1_on(void);
+void ergodox_right_led_2_on(void);
+void ergodox_right_led_3_on(void);
+void ergodox_board_led_off(void);
+void ergodox_right_led_1_off(void);
+void ergodox_right_led_2_off(void);
+void ergodox_right_led_3_off(void);
+
+void matrix_scan_user(void);
@@ -0,0 +1,116 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * The parts of uGFX that the visualizer and this keymap use, for the host
+ * build. See mock-gfx.c for how they behave.
+ *
+ * Time is virtual: a tick is a millisecond, and it only moves on when the
+ * host harness says so. Threads are coroutines that the harness runs one at a
+ * time, so every run of the same trace gives the same frames.
+ *
+ * The display records what is drawn to it. Like the ST7565 driver, blits and
+ * fills only go into its RAM, and gdispGFlush() sends all of the RAM to the
+ * LCD if anything changed.
+*/
+
+typedef uint32_t systemticks_t;
+typedef uint32_t delaytime_t;
+
+#define TIME_IMMEDIATE ((delaytime_t)0)
+#define TIME_INFINITE ((delaytime_t)-1)
+
+#define gfxMillisecondsToTicks(ms) ((systemticks_t)(ms))
+
+// ChibiOS, which uGFX includes on the board, with the same clock
+typedef systemticks_t systime_t;
+
+#define chVTGetSystemTimeX() gfxSystemTicks()
+#define TIME_MS2I(ms) ((systime_t)(ms))
+
+systemticks_t gfxSystemTicks(void);
+void gfxSleepMilliseconds(delaytime_t ms);
+void gfxInit(void);
+
+typedef int threadreturn_t;
+typedef int threadpriority_t;
+typedef void* gfxThreadHandle;
+
+#define NORMAL_PRIORITY 0
+#define DECLARE_THREAD_STACK(name, size) uint8_t name[size]
+#define DECLARE_THREAD_FUNCTION(name, param) threadreturn_t name(void* param)
+
+gfxThreadHandle gfxThreadCreate(void* stack, size_t stack_size, threadpriority_t priority, threadreturn_t (*function)(void*), void* param);
+
+struct host_thread;
+
+typedef struct {
+    struct host_thread* thread;
+} GListener;
+
+typedef void* GSourceHandle;
+
+typedef struct {
+    GSourceHandle source;
+    GListener*    listener;
+} GSourceListener;
+
+void geventListenerInit(GListener* listener);
+bool geventAttachSource(GListener* listener, GSourceHandle source, unsigned flags);
+GSourceListener* geventGetSourceListener(GSourceHandle source, GSourceListener* last);
+void geventSendEvent(GSourceListener* source_listener);
+void* geventEventWait(GListener* listener, delaytime_t timeout);
+
+// A monochrome display, gColor is a single bit like with GDISP_PIXELFORMAT_MONO
+typedef uint8_t gColor;
+typedef gColor  gPixel;
+typedef gColor  pixel_t;
+typedef int16_t gCoord;
+
+#define White 1
+#define Black 0
+
+typedef enum { powerOff, powerOn } gPowermode;
+
+#define HOST_DISPLAY_WIDTH 128
+#define HOST_DISPLAY_HEIGHT 32
+
+/**
+ * GDisplay
+ *
+ * ram: what the driver holds, one byte per pixel, 1 for white
+ * lcd: what the LCD shows, the ram as of the last flush that sent anything
+ * needs_flush: the ram changed since then
+*/
+typedef struct GDisplay {
+    uint8_t ram[HOST_DISPLAY_HEIGHT][HOST_DISPLAY_WIDTH];
+    uint8_t lcd[HOST_DISPLAY_HEIGHT][HOST_DISPLAY_WIDTH];
+    bool    needs_flush;
+    bool    powered;
+} GDisplay;
+
+// The display of the keyboard half the harness is running
+GDisplay* host_get_display(void);
+
+#define GDISP (host_get_display())
+
+GDisplay* gdispGetDisplay(unsigned display);
+void gdispGBlitArea(GDisplay* g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel* buffer);
+void gdispGFillArea(GDisplay* g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor color);
+void gdispGClear(GDisplay* g, gColor color);
+void gdispGFlush(GDisplay* g);
+void gdispGSetPowerMode(GDisplay* g, gPowermode mode);
+void gdispGSetBacklight(GDisplay* g, unsigned percent);
+
+#define gdispClear(color) gdispGClear(GDISP, color)
+#define gdispSetPowerMode(mode) gdispGSetPowerMode(GDISP, mode)
+
+typedef const struct host_font* gFont;
+
+gFont gdispOpenFont(const char* name);
+void gdispCloseFont(gFont font);
+
+// The CPU time of the calling thread in ns, for VISUALIZER_STATS_CLOCK()
+uint32_t host_cpu_clock(void);
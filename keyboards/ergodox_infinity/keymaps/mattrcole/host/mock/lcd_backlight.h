@@ -0,0 +1,12 @@
+#pragma once
+#include <stdint.h>
+
+// Same as quantum/visualizer/lcd_backlight.h, the color is kept by mock-qmk.c
+#define LCD_COLOR(hue, saturation, intensity) ((hue << 16) | (saturation << 8) | (intensity))
+#define LCD_HUE(color) ((color >> 16) & 0xFF)
+#define LCD_SAT(color) ((color >> 8) & 0xFF)
+#define LCD_INT(color) (color & 0xFF)
+
+void lcd_backlight_init(void);
+void lcd_backlight_color(uint8_t hue, uint8_t saturation, uint8_t intensity);
+void lcd_backlight_brightness(uint8_t b);
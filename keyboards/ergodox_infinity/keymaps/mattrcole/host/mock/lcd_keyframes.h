@@ -0,0 +1,7 @@
+#pragma once
+#include "visualizer.h"
+
+// The keyframes of quantum/visualizer/lcd_keyframes.h this keymap uses, see mock-qmk.c
+bool lcd_keyframe_draw_logo(keyframe_animation_t* animation, visualizer_state_t* state);
+bool lcd_keyframe_enable(keyframe_animation_t* animation, visualizer_state_t* state);
+bool lcd_keyframe_disable(keyframe_animation_t* animation, visualizer_state_t* state);
@@ -0,0 +1,4 @@
+#pragma once
+
+#define dprint(s)
+#define dprintf(fmt, ...)
@@ -0,0 +1,36 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * The remote objects of the serial_link transport, for the host build.
+ *
+ * Like on the board, the master writes an object with begin_write_ and
+ * end_write_, which sends it to the slaves, and a slave's read_ returns the
+ * newest copy that arrived since it last read the object, or NULL. The
+ * objects are told apart by the order they were added in, which is the
+ * same on both halves. See mock-serial-link.c for the link itself.
+*/
+
+typedef struct {
+    uint16_t object_size;
+    uint8_t* write_buffer;
+    uint8_t* read_buffer;
+} remote_object_t;
+
+void add_remote_objects(remote_object_t** remote_objects, uint32_t num_remote_objects);
+
+// Sends the write_buffer of the object to the slaves, if this is the master
+void host_link_send(remote_object_t* object);
+// Copies the newest copy of the object that arrived to its read_buffer
+bool host_link_receive(remote_object_t* object);
+
+#define MASTER_TO_ALL_SLAVES_OBJECT(name, type)                                                                               \
+    static type            name##_write_buffer;                                                                               \
+    static type            name##_read_buffer;                                                                                \
+    static remote_object_t name##_remote_object = {sizeof(type), (uint8_t*)&name##_write_buffer, (uint8_t*)&name##_read_buffer}; \
+    static inline type*    begin_write_##name(void) { return &name##_write_buffer; }                                          \
+    static inline void     end_write_##name(void) { host_link_send(&name##_remote_object); }                                  \
+    static inline type*    read_##name(void) { return host_link_receive(&name##_remote_object) ? &name##_read_buffer : NULL; }
+
+#define REMOTE_OBJECT(name) (&name##_remote_object)
@@ -0,0 +1,11 @@
+#pragma once
+#include <stdbool.h>
+
+/**
+ * The serial link between the halves, for the host build with
+ * SERIAL_LINK_ENABLE. The first half is the master, the one with USB, the
+ * other one is connected to it. See mock-serial-link.c.
+*/
+
+bool is_serial_link_master(void);
+bool is_serial_link_connected(void);
@@ -0,0 +1,4 @@
+#pragma once
+
+// The keymap's visualizer.c includes this on every build, the serial link
+// itself is only there with SERIAL_LINK_ENABLE
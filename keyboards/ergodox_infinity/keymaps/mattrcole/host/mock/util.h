@@ -0,0 +1,5 @@
+#pragma once
+#include <stdint.h>
+
+// the index of the highest bit that is set, 0 if none is
+uint8_t biton32(uint32_t bits);
@@ -0,0 +1,3 @@
+#pragma once
+
+#define QMK_VERSION "host"
@@ -0,0 +1,4 @@
+#pragma once
+#include "visualizer.h"
+
+bool keyframe_no_operation(keyframe_animation_t* animation, visualizer_state_t* state);
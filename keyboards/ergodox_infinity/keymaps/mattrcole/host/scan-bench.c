@@ -0,0 +1,96 @@
+/**
+ * What the keymap and the visualizer cost the matrix scan, with the gaming
+ * mode of the build, see LayerDisplayPolicies. The scan-bench target runs
+ * it with VISUALIZER_GAMING_MODE on and off.
+ *
+ * Every scan of the keyboard calls matrix_scan_user() and then
+ * visualizer_update(), and whenever the visualizer thread wakes up it takes
+ * the CPU away from the scans. For every layer but FN_LAYER:
+ *
+ * scan: CPU time of matrix_scan_user and visualizer_update per scan, while
+ *      resting on the layer, 200000 scans timed as one
+ * trace: 20 s on the layer, holding FN for 300 ms every 2 s. Wakeups of the
+ *      visualizer thread, its CPU time per second of the trace, and the
+ *      longest it ran before waiting again.
+ * scans left: the share of the CPU the thread leaves to the scans, the
+ *      scan rate drops by the rest
+ * latency: the most the keymap and the visualizer add to the time from a
+ *      keypress to its report, one scan plus the longest run of the thread,
+ *      which a scan can end up waiting behind
+ *
+ * Reading the matrix, debouncing and sending the report cost the same with
+ * gaming mode on and off, and aren't part of the host build. All times are
+ * the host's CPU time.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host.h"
+#include "ergodox_infinity.h"
+
+#define STEADY_SCANS 200000
+#define TRACE_LENGTH 20000
+#define FN_PERIOD 2000
+#define FN_HOLD 300
+
+static void scan(const layer_state_t layers) {
+    layer_state = layers;
+    matrix_scan_user();
+    host_scan(layers);
+}
+
+static void run_layer(const Layers layer) {
+    const layer_state_t resting = host_layer_state(layer);
+    const layer_state_t holding_fn = resting | host_layer_state(FN_LAYER);
+
+    host_settle(resting, 5000);
+    scan(resting);
+
+    const uint32_t start = host_cpu_clock();
+    for (uint32_t i = 0; i < STEADY_SCANS; i++) scan(resting);
+    const uint32_t scan_time = (host_cpu_clock() - start) / (STEADY_SCANS / 1000);
+
+    host_reset_counters();
+
+    const systemticks_t trace_start = host_get_time();
+    uint32_t scan_max_time = 0;
+
+    for (systemticks_t t = 0; t < TRACE_LENGTH; t++) {
+        const uint32_t scan_start = host_cpu_clock();
+
+        scan(t % FN_PERIOD < FN_HOLD ? holding_fn : resting);
+
+        const uint32_t this_scan_time = host_cpu_clock() - scan_start;
+        if (this_scan_time > scan_max_time) scan_max_time = this_scan_time;
+
+        host_run_until(trace_start + t + 1);
+    }
+
+    const host_counters_t *const counters = host_get_counters(0);
+    const uint64_t run_time_per_second = counters->run_time * 1000 / TRACE_LENGTH;
+
+    printf("%-6s %8.1f | %7lu %9lu %9lu | %9.4f%% | %9lu\n",
+        host_layer_name(layer),
+        scan_time / 1000.0,
+        (unsigned long)counters->wakeups,
+        (unsigned long)(run_time_per_second / 1000),
+        (unsigned long)(counters->max_run_time / 1000),
+        100.0 - run_time_per_second / 1e7,
+        (unsigned long)((scan_max_time + counters->max_run_time) / 1000));
+}
+
+int main(void) {
+#ifdef GAMING_MODE_ENABLE
+    printf("gaming mode on\n");
+#else
+    printf("gaming mode off\n");
+#endif
+    printf("%-6s %8s | %7s %9s %9s | %10s | %9s\n", "", "scan ns", "wakeups", "us per s", "max us", "scans left", "worst us");
+
+    host_boot(WIN_LAYOUT);
+
+    for (Layers layer = 0; layer < FN_LAYER; layer++) run_layer(layer);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/**
+ * Looks for torn reads of the status the matrix scan hands to the visualizer
+ * thread, see publish_status and read_published_status.
+ *
+ * A pthread takes the place of the matrix scan and publishes one status after
+ * the other as fast as it can, every field of it, the time included, derived
+ * from a counter. The main thread takes the place of the visualizer thread
+ * and keeps reading snapshots. A snapshot is torn if its fields don't all
+ * derive from the same count, and out of order if it's older than the one
+ * read before it. Both are failures.
+ *
+ * The same is then done with the reads unchecked: a copy of the current
+ * buffer, without looking at status_sequence again afterwards. Those should
+ * turn up torn reads, which shows the test can see them. On a single core
+ * they may not, the unchecked reads are only reported.
+ *
+ * This file includes quantum's visualizer.c to get at the snapshots, neither
+ * thread runs anything else of the visualizer.
+ *
+ * seqlock-stress [reads]: 10000000 reads of each kind by default
+*/
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host.h"
+#include "../../../../../quantum/visualizer/visualizer.c"
+
+typedef void (*read_t)(status_snapshot_t *snapshot);
+
+static bool writer_stopped;
+
+// every field of the status the writer publishes for count
+static void make_status(visualizer_keyboard_status_t *const status, const uint32_t count) {
+    status->layer = count;
+    status->default_layer = ~count;
+    status->leds = count * 2654435761u;
+    status->mods = count;
+    status->suspended = count & 1;
+#ifdef BACKLIGHT_ENABLE
+    status->backlight_level = count >> 8;
+#endif
+#ifdef VISUALIZER_USER_DATA_SIZE
+    for (uint8_t i = 0; i < VISUALIZER_USER_DATA_SIZE; i++) status->user_data[i] = count + i;
+#endif
+}
+
+static void *write_statuses(void *const unused) {
+    for (uint32_t count = 1; !__atomic_load_n(&writer_stopped, __ATOMIC_RELAXED); count++) {
+        make_status(&current_status, count);
+        current_status_time = count;
+        publish_status();
+    }
+
+    return NULL;
+}
+
+static void read_unchecked(status_snapshot_t *const snapshot) {
+    const uint32_t sequence = __atomic_load_n(&status_sequence, __ATOMIC_ACQUIRE);
+
+    *snapshot = published_status[(sequence >> 1) & 1];
+}
+
+static bool is_torn(const status_snapshot_t *const snapshot) {
+    visualizer_keyboard_status_t expected;
+
+    // nothing published yet
+    if (snapshot->time == 0) return false;
+
+    make_status(&expected, snapshot->time);
+
+    return memcmp(&expected, &snapshot->status, sizeof(expected)) != 0;
+}
+
+static void run_reads(const char *const name, const read_t read, const uint32_t reads, const bool must_be_whole) {
+    pthread_t writer;
+    status_snapshot_t snapshot;
+    systemticks_t previous_time = 0;
+    uint32_t torn = 0;
+    uint32_t out_of_order = 0;
+
+    memset(published_status, 0, sizeof(published_status));
+    status_sequence = 0;
+    __atomic_store_n(&writer_stopped, false, __ATOMIC_RELAXED);
+
+    if (pthread_create(&writer, NULL, write_statuses, NULL) != 0) host_fail("couldn't start the writer");
+
+    const uint32_t start = host_cpu_clock();
+
+    for (uint32_t i = 0; i < reads; i++) {
+        read(&snapshot);
+
+        if (is_torn(&snapshot)) torn++;
+        if ((int32_t)(snapshot.time - previous_time) < 0) out_of_order++;
+
+        previous_time = snapshot.time;
+    }
+
+    const uint32_t read_time = host_cpu_clock() - start;
+
+    __atomic_store_n(&writer_stopped, true, __ATOMIC_RELAXED);
+    pthread_join(writer, NULL);
+
+    printf("%-9s %10lu %10lu %7lu %12lu %8.1f\n", name, (unsigned long)reads, (unsigned long)previous_time,
+        (unsigned long)torn, (unsigned long)out_of_order, (double)read_time / reads);
+
+    if (must_be_whole && (torn > 0 || out_of_order > 0)) {
+        host_fail("%s: %lu torn and %lu out of order reads", name, (unsigned long)torn, (unsigned long)out_of_order);
+    }
+}
+
+int main(int argc, char **argv) {
+    const int reads = argc > 1 ? atoi(argv[1]) : 10000000;
+
+    if (reads <= 0) host_fail("usage: %s [reads]", argv[0]);
+
+    printf("%-9s %10s %10s %7s %12s %8s\n", "", "reads", "published", "torn", "out of order", "ns/read");
+
+    run_reads("checked", read_published_status, reads, true);
+    run_reads("unchecked", read_unchecked, reads, false);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,77 @@
+/**
+ * What the visualizer costs at startup with the VISUALIZER_LAZY_FONTS of the
+ * build, and what the layer text costs drawn from the glyph atlas. The
+ * startup-bench target runs it with lazy fonts on and off.
+ *
+ * startup: visualizer_init(), then the visualizer thread until the startup
+ *      animation is over and the first layer has slid in. The uGFX fonts
+ *      opened, the CPU time of visualizer_init() and of the thread.
+ * suspend: visualizer_suspend(), then the thread until the suspend animation
+ *      is over, "Suspending..." included. The same as for startup.
+ * text: CPU time of a single lcd_framebuffer_draw_text() of
+ *      "Suspending..." from the atlas, TEXT_DRAWS of them timed as one
+ * atlas: bytes resource_font_dejavusansbold12 takes in flash, the atlas
+ *      bitmap and the glyph table. The structs pointing at them aren't
+ *      counted, their size depends on the pointers. None of it is in RAM.
+ *
+ * uGFX isn't part of the host build, so what opening a font or drawing text
+ * with one costs on the keyboard isn't either, only how many fonts are
+ * opened. All times are the host's CPU time.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host.h"
+#include "lcd-framebuffer.h"
+
+#define TEXT_DRAWS 100000
+#define SUSPEND_LENGTH 2000
+
+static const char suspend_text[] = "Suspending...";
+
+static void print_run(const char *const name, const uint32_t font_opens, const uint32_t call_time) {
+    const host_counters_t *const counters = host_get_counters(0);
+
+    printf("%-8s %6lu %8.1f %10.1f\n", name, (unsigned long)font_opens, call_time / 1000.0, counters->run_time / 1000.0);
+}
+
+int main(void) {
+#ifdef VISUALIZER_LAZY_FONTS
+    printf("lazy fonts on\n");
+#else
+    printf("lazy fonts off\n");
+#endif
+    printf("%-8s %6s %8s %10s\n", "", "fonts", "call us", "thread us");
+
+    default_layer_state = host_layer_state(WIN_LAYOUT);
+    host_reset_counters();
+
+    uint32_t start = host_cpu_clock();
+    visualizer_init();
+    const uint32_t init_time = host_cpu_clock() - start;
+
+    // the startup animation takes 5 s, then the first layer slides in
+    host_settle(host_layer_state(WIN_LAYOUT), 10000);
+    print_run("startup", host_get_font_opens(), init_time);
+
+    const uint32_t opens_before_suspend = host_get_font_opens();
+    host_reset_counters();
+
+    start = host_cpu_clock();
+    visualizer_suspend();
+    const uint32_t suspend_time = host_cpu_clock() - start;
+
+    host_run_until(host_get_time() + SUSPEND_LENGTH);
+    print_run("suspend", host_get_font_opens() - opens_before_suspend, suspend_time);
+
+    start = host_cpu_clock();
+    for (uint32_t i = 0; i < TEXT_DRAWS; i++) lcd_framebuffer_draw_text(0, 10, suspend_text, &resource_font_dejavusansbold12);
+    const uint32_t text_time = (host_cpu_clock() - start) / (TEXT_DRAWS / 1000);
+
+    printf("text: %.1f ns per \"%s\"\n", text_time / 1000.0, suspend_text);
+    printf("atlas: %u B bitmap, %u B for %u glyphs\n", (unsigned)resource_font_dejavusansbold12.atlas->size,
+        (unsigned)(resource_font_dejavusansbold12.num_glyphs * sizeof(resource_glyph_t)), (unsigned)resource_font_dejavusansbold12.num_glyphs);
+
+    return EXIT_SUCCESS;
+}
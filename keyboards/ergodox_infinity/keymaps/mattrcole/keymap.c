@@ -1,5 +1,7 @@
 #include QMK_KEYBOARD_H
 #include "version.h"
+#include "led-state.h"
+#include "visualizer-stats.h"
 
 #define MEDIA      5 // Media layer
 #define WIN_LAYOUT 0 // windows
@@ -12,7 +14,8 @@ enum custom_keycodes {
   PLACEHOLDER = SAFE_RANGE, // can always be here
   EPRM,
   VRSN,
-  RGB_SLD
+  RGB_SLD,
+  VSTATS // types the visualizer stats, see visualizer-stats.h
 };
 
 const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
@@ -249,10 +252,33 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
       }
       return false;
       break;
+    case VSTATS:
+      if (record->event.pressed) {
+        #ifdef VISUALIZER_STATS_ENABLE
+          // a line at a time, all of them at once would take 348 bytes of stack
+          char stats[VISUALIZER_STATS_LINE_SIZE];
+          for (uint8_t line = 0; line < VISUALIZER_STATS_LINES; line++) {
+            visualizer_stats_format(stats, sizeof(stats), line);
+            send_string(stats);
+          }
+        #endif
+      }
+      return false;
+      break;
   }
   return true;
 }
 
+#ifdef VISUALIZER_STATS_ENABLE
+// Only there to time how long it takes a layer change to reach the LCD. The
+// visualizer only shows the top layer, a key that leaves it alone would never
+// get there.
+layer_state_t layer_state_set_user(layer_state_t state) {
+    if (biton32(state) != biton32(layer_state)) VISUALIZER_STATS_LAYER_KEY();
+    return state;
+}
+#endif
+
 // Runs just one time when the keyboard initializes.
 void matrix_init_user(void) {
 
@@ -261,9 +287,22 @@ void matrix_init_user(void) {
 
 // Runs constantly in the background, in a loop.
 void matrix_scan_user(void) {
+    static uint8_t led_layer = 0xFF;
 
     uint8_t layer = biton32(layer_state);
 
+    // some layers only set the leds once, when they're entered. Anything else
+    // that turns them on or off still has to reach the visualizer though.
+    if (layer == led_layer && led_state_is_paused(layer)) {
+        led_state_sync();
+        VISUALIZER_STATS_INCREMENT(led_scans_paused);
+        return;
+    }
+
+    VISUALIZER_STATS_TIMER_START(start_time);
+
+    led_layer = layer;
+
     ergodox_board_led_off();
     ergodox_right_led_1_off();
     ergodox_right_led_2_off();
@@ -281,4 +320,8 @@ void matrix_scan_user(void) {
             break;
     }
 
+    led_state_sync();
+
+    VISUALIZER_STATS_INCREMENT(led_scans);
+    VISUALIZER_STATS_TIMER_STOP(start_time, led_scan_time, led_scan_max_time);
 };
@@ -0,0 +1,404 @@
+/**
+ * An off-screen copy of the 128x32 LCD.
+ *
+ * All element drawing goes into this buffer first. Nothing reaches the
+ * display driver until lcd_framebuffer_flush() is called, which copies only
+ * the (merged) regions that were touched since the previous flush into the
+ * driver's buffer. That way an area that is erased and then drawn over again
+ * during the same update is only copied once, in its final state.
+ *
+ * The driver's buffer is what goes to the LCD. The ST7565 driver sends all of
+ * it, every page, with the visualizer thread's gdispGFlush() after any update
+ * that copied something. So the regions save the copies and the drawing that
+ * isn't seen, but not SPI traffic, which is a whole frame per changed update.
+ *
+ * The buffer uses the exact same format as the bitmap resources, 8 pixels per
+ * byte, most significant bit first, row by row, a set bit being a white pixel.
+ * That means it can be handed to gdispGBlitArea just like any other resource.
+ *
+ * Drawing works on 32 pixel words instead of single pixels. Source bits are
+ * shifted into place a whole word at a time, so elements sliding along the X
+ * axis by offsets that aren't a multiple of 8 cost the same as aligned ones.
+ *
+ * Compressed bitmaps are decoded while drawing, one row at a time, straight
+ * into the rows being composed, so no decompressed copy is ever kept. Page
+ * ordered bitmaps are turned into rows 8 at a time, one 8x8 block per byte
+ * column.
+*/
+
+#include <string.h>
+
+#ifdef EMULATOR
+#include <stdio.h>
+#endif
+
+#include "lcd-framebuffer.h"
+#include "dirty-regions.h"
+#include "visualizer-stats.h"
+
+#define WORD_BITS 32
+#define ROW_WORDS (LCD_WIDTH / WORD_BITS)
+#define MAX_SOURCE_ROW_BYTES ((UINT8_MAX + 7) / 8)
+#define MAX_PAGE_ROW_BYTES (LCD_WIDTH / 8)
+#define PAGE_HEIGHT 8
+
+_Static_assert(LCD_WIDTH % WORD_BITS == 0, "The framebuffer kernel needs the LCD width to be a multiple of 32");
+
+// stored as words so that they can be loaded whole, the byte order in memory
+// is still the one gdispGBlitArea expects
+static uint32_t framebuffer[ROW_WORDS * LCD_HEIGHT];
+
+#ifdef EMULATOR
+static uint32_t frame_number = 0;
+#endif
+
+static inline uint32_t load_word(const uint32_t *const word) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return __builtin_bswap32(*word);
+#else
+    return *word;
+#endif
+}
+
+static inline void store_word(uint32_t *const word, const uint32_t value) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    *word = __builtin_bswap32(value);
+#else
+    *word = value;
+#endif
+}
+
+// mask of the bits [start, end) of a word, bit 0 being the most significant one
+static inline uint32_t span_mask(const int16_t start, const int16_t end) {
+    if (start >= end) return 0;
+
+    const uint32_t from_start = 0xffffffffu >> start;
+    const uint32_t to_end = end == WORD_BITS ? 0xffffffffu : ~(0xffffffffu >> end);
+
+    return from_start & to_end;
+}
+
+static inline uint8_t get_source_byte(const uint8_t *const row, const uint8_t row_bytes, const int16_t index) {
+    return index >= 0 && index < row_bytes ? row[index] : 0;
+}
+
+// the 32 source bits starting at bit_index, which may lie outside of the row
+static uint32_t get_source_word(const uint8_t *const row, const uint8_t row_bytes, const int16_t bit_index) {
+    const int16_t first_byte = bit_index >> 3;
+    const uint8_t shift = bit_index & 7;
+
+    uint32_t word = 0;
+    for (uint8_t i = 0; i < 4; i++) {
+        word = (word << 8) | get_source_byte(row, row_bytes, first_byte + i);
+    }
+
+    if (shift) word = (word << shift) | (get_source_byte(row, row_bytes, first_byte + 4) >> (8 - shift));
+
+    return word;
+}
+
+/**
+ * SourceReader
+ *
+ * Hands out the rows of a bitmap one at a time, in increasing order.
+ * Raw bitmaps are read in place. Compressed ones are decoded into row, and
+ * rows that are skipped over get decoded and thrown away. Page ordered ones
+ * are transposed a whole page at a time into page_rows.
+*/
+typedef struct {
+    const resource_bitmap_t *bitmap;
+    uint8_t                  row_bytes;
+    int16_t                  decoded_rows;
+    const uint8_t           *next;        // next byte of compressed data
+    const uint8_t           *end;
+    uint8_t                  run_left;    // bytes left in the current run
+    bool                     run_repeats;
+    int16_t                  page;        // page currently held in page_rows
+    union {
+        uint8_t row[MAX_SOURCE_ROW_BYTES];
+        uint8_t page_rows[PAGE_HEIGHT][MAX_PAGE_ROW_BYTES];
+    };
+} SourceReader;
+
+static void initialize_source_reader(SourceReader *const reader, const resource_bitmap_t *const bitmap) {
+    reader->bitmap = bitmap;
+    reader->row_bytes = (bitmap->width + 7) / 8;
+    // generate-resources.py doesn't make them any wider, the columns that
+    // don't fit into page_rows are left black
+    if (bitmap->format == RESOURCE_FORMAT_PAGES && reader->row_bytes > MAX_PAGE_ROW_BYTES) reader->row_bytes = MAX_PAGE_ROW_BYTES;
+    reader->decoded_rows = 0;
+    reader->next = bitmap->data;
+    reader->end = bitmap->data + bitmap->size;
+    reader->run_left = 0;
+    reader->run_repeats = false;
+    reader->page = -1;
+}
+
+// see resource_format_t for a description of the PackBits format
+static void decode_packbits_row(SourceReader *const reader) {
+    for (uint8_t i = 0; i < reader->row_bytes; i++) {
+        while (reader->run_left == 0 && reader->next < reader->end) {
+            const uint8_t header = *reader->next++;
+
+            if (header < 128) {
+                reader->run_left = header + 1;
+                reader->run_repeats = false;
+            }
+            else if (header > 128) {
+                reader->run_left = 257 - header;
+                reader->run_repeats = true;
+            }
+        }
+
+        // truncated data, the rest of the bitmap is left black
+        if (reader->run_left == 0 || reader->next >= reader->end) {
+            memset(&reader->row[i], 0, reader->row_bytes - i);
+            return;
+        }
+
+        reader->row[i] = *reader->next;
+        reader->run_left--;
+
+        if (!reader->run_repeats || reader->run_left == 0) reader->next++;
+    }
+}
+
+/**
+ * Turns 8 page bytes, one per column with the top pixel in the least
+ * significant bit, into 8 row bytes, with the first column in the most
+ * significant bit. This is the 8x8 bit matrix transpose from Hacker's
+ * Delight, done on two 32 bit halves.
+*/
+static void transpose_page_block(const uint8_t *const columns, uint8_t *const rows[PAGE_HEIGHT], const uint8_t row_byte) {
+    uint32_t upper = (uint32_t)columns[0] << 24 | (uint32_t)columns[1] << 16 | (uint32_t)columns[2] << 8 | columns[3];
+    uint32_t lower = (uint32_t)columns[4] << 24 | (uint32_t)columns[5] << 16 | (uint32_t)columns[6] << 8 | columns[7];
+    uint32_t swap;
+
+    swap = (upper ^ (upper >> 7)) & 0x00aa00aa;   upper ^= swap ^ (swap << 7);
+    swap = (lower ^ (lower >> 7)) & 0x00aa00aa;   lower ^= swap ^ (swap << 7);
+    swap = (upper ^ (upper >> 14)) & 0x0000cccc;  upper ^= swap ^ (swap << 14);
+    swap = (lower ^ (lower >> 14)) & 0x0000cccc;  lower ^= swap ^ (swap << 14);
+
+    swap = (upper & 0xf0f0f0f0) | ((lower >> 4) & 0x0f0f0f0f);
+    lower = ((upper << 4) & 0xf0f0f0f0) | (lower & 0x0f0f0f0f);
+    upper = swap;
+
+    // the transpose yields the bottom row first
+    for (uint8_t i = 0; i < 4; i++) {
+        rows[7 - i][row_byte] = upper >> (24 - 8 * i);
+        rows[3 - i][row_byte] = lower >> (24 - 8 * i);
+    }
+}
+
+// see resource_format_t for a description of the page format
+static void decode_page(SourceReader *const reader, const int16_t page) {
+    const uint8_t width = reader->bitmap->width;
+    const uint8_t *const page_data = reader->bitmap->data + page * width;
+    const uint8_t columns_kept = reader->row_bytes * 8;
+    uint8_t *rows[PAGE_HEIGHT];
+
+    for (uint8_t i = 0; i < PAGE_HEIGHT; i++) rows[i] = reader->page_rows[i];
+
+    for (uint8_t column = 0; column < width && column < columns_kept; column += 8) {
+        uint8_t columns[8] = { 0 };
+        memcpy(columns, page_data + column, width - column < 8 ? width - column : 8);
+
+        transpose_page_block(columns, rows, column / 8);
+    }
+
+    reader->page = page;
+}
+
+static const uint8_t *read_source_row(SourceReader *const reader, const int16_t row) {
+    switch (reader->bitmap->format) {
+        case RESOURCE_FORMAT_RAW:
+            return reader->bitmap->data + row * reader->row_bytes;
+
+        case RESOURCE_FORMAT_PACKBITS:
+            while (reader->decoded_rows <= row) {
+                decode_packbits_row(reader);
+                reader->decoded_rows++;
+            }
+            return reader->row;
+
+        case RESOURCE_FORMAT_PAGES:
+            if (reader->page != row / PAGE_HEIGHT) decode_page(reader, row / PAGE_HEIGHT);
+            return reader->page_rows[row % PAGE_HEIGHT];
+    }
+
+    return NULL;
+}
+
+static inline int16_t max16(const int16_t a, const int16_t b) { return a > b ? a : b; }
+static inline int16_t min16(const int16_t a, const int16_t b) { return a < b ? a : b; }
+
+void lcd_framebuffer_compose(const int16_t x, const int16_t y, const int16_t width, const int16_t height, const int16_t source_offset_x, const int16_t source_offset_y, const resource_bitmap_t *const source, const gColor fill_color) {
+    const int16_t area_left = max16(x, 0);
+    const int16_t area_right = min16(x + width, LCD_WIDTH);
+    const int16_t area_top = max16(y, 0);
+    const int16_t area_bottom = min16(y + height, LCD_HEIGHT);
+
+    if (area_left >= area_right || area_top >= area_bottom) return;
+
+    const int16_t source_left = x + source_offset_x;
+    const int16_t source_top = y + source_offset_y;
+    const int16_t copy_left = max16(area_left, source_left);
+    const int16_t copy_right = min16(area_right, source_left + (source != NULL ? source->width : 0));
+    const uint32_t fill = fill_color != Black ? 0xffffffffu : 0;
+
+    SourceReader reader;
+    if (source != NULL) initialize_source_reader(&reader, source);
+
+    for (int16_t screen_y = area_top; screen_y < area_bottom; screen_y++) {
+        const int16_t source_y = screen_y - source_top;
+        const bool row_has_source = source != NULL && source_y >= 0 && source_y < source->height && copy_left < copy_right;
+        const uint8_t *const source_row = row_has_source ? read_source_row(&reader, source_y) : NULL;
+        uint32_t *const row = &framebuffer[screen_y * ROW_WORDS];
+
+        for (int16_t word_x = area_left & ~(WORD_BITS - 1); word_x < area_right; word_x += WORD_BITS) {
+            const uint32_t area_mask = span_mask(max16(area_left - word_x, 0), min16(area_right - word_x, WORD_BITS));
+            uint32_t value = fill;
+
+            if (row_has_source) {
+                const uint32_t copy_mask = span_mask(max16(copy_left - word_x, 0), min16(copy_right - word_x, WORD_BITS));
+
+                if (copy_mask) {
+                    const uint32_t source_bits = get_source_word(source_row, reader.row_bytes, word_x - source_left);
+                    value = (value & ~copy_mask) | (source_bits & copy_mask);
+                }
+            }
+
+            uint32_t *const word = &row[word_x / WORD_BITS];
+            store_word(word, (load_word(word) & ~area_mask) | (value & area_mask));
+        }
+    }
+
+    if (source != NULL) VISUALIZER_STATS_INCREMENT(blits);
+    else                VISUALIZER_STATS_INCREMENT(fills);
+    VISUALIZER_STATS_ADD(pixels_drawn, (area_right - area_left) * (area_bottom - area_top));
+
+    dirty_regions_add(area_left, area_top, area_right - area_left, area_bottom - area_top);
+}
+
+void lcd_framebuffer_blit(const uint8_t x, const uint8_t y, const uint8_t width, const uint8_t height, const uint8_t source_x, const uint8_t source_y, const uint8_t source_row_length, const uint8_t *const source) {
+    const resource_bitmap_t bitmap = {
+        .format = RESOURCE_FORMAT_RAW,
+        .width  = source_row_length,
+        .height = source_y + height,
+        .size   = (source_row_length + 7) / 8 * (source_y + height),
+        .data   = source
+    };
+
+    // the area always lies within the source, so the fill color is never used
+    lcd_framebuffer_compose(x, y, width, height, -source_x, -source_y, &bitmap, White);
+}
+
+void lcd_framebuffer_fill(const uint8_t x, const uint8_t y, const uint8_t width, const uint8_t height, const gColor color) {
+    lcd_framebuffer_compose(x, y, width, height, 0, 0, NULL, color);
+}
+
+static const resource_glyph_t *find_glyph(const resource_font_t *const font, const char character) {
+    for (uint8_t i = 0; i < font->num_glyphs && font->glyphs[i].character <= character; i++) {
+        if (font->glyphs[i].character == character) return &font->glyphs[i];
+    }
+
+    return NULL;
+}
+
+int16_t lcd_framebuffer_draw_text(const int16_t x, const int16_t y, const char *text, const resource_font_t *const font) {
+    int16_t position = x;
+
+    for (; *text != '\0'; text++) {
+        const resource_glyph_t *const glyph = find_glyph(font, *text);
+        if (glyph == NULL) continue;
+
+        // the atlas covers the whole glyph, so the fill color is never used
+        lcd_framebuffer_compose(position, y, glyph->width, font->atlas->height, -glyph->x, 0, font->atlas, White);
+        position += glyph->width;
+    }
+
+    return position - x;
+}
+
+void lcd_framebuffer_clear(const gColor color) {
+    memset(framebuffer, color != Black ? 0xff : 0x00, sizeof(framebuffer));
+
+    dirty_regions_add(0, 0, LCD_WIDTH, LCD_HEIGHT);
+}
+
+void lcd_framebuffer_apply_delta(const uint8_t *const runs, const uint16_t size, const uint8_t x, const uint8_t y, const uint8_t width, const uint8_t height) {
+    // the byte order in memory is the one of the resources, whatever the word order
+    uint8_t *const bytes = (uint8_t*)framebuffer;
+    uint16_t position = 0;
+
+    for (uint16_t i = 0; i + 1 < size;) {
+        position += runs[i];
+        const uint8_t length = runs[i + 1];
+        i += 2;
+
+        for (uint8_t j = 0; j < length && i < size; j++, i++, position++) {
+            if (position < sizeof(framebuffer)) bytes[position] ^= runs[i];
+        }
+    }
+
+    VISUALIZER_STATS_INCREMENT(deltas);
+    VISUALIZER_STATS_ADD(delta_bytes, size);
+
+    dirty_regions_add(x, y, width, height);
+}
+
+void lcd_framebuffer_flush(void) {
+    if (dirty_regions_empty()) return;
+
+    VISUALIZER_STATS_INCREMENT(flushes);
+
+    for (uint8_t i = 0; i < dirty_regions_count(); i++) {
+        const DirtyRegion *const region = dirty_regions_get(i);
+        const uint8_t x = region->upper_left_coordinates[0];
+        const uint8_t y = region->upper_left_coordinates[1];
+        const uint8_t width = region->lower_right_coordinates[0] - x + 1;
+        const uint8_t height = region->lower_right_coordinates[1] - y + 1;
+
+        gdispGBlitArea(GDISP, x, y, width, height, x, y, LCD_WIDTH, (const gPixel*)framebuffer);
+
+        VISUALIZER_STATS_INCREMENT(region_blits);
+        VISUALIZER_STATS_ADD(region_pixels, width * height);
+        // every row touches the bytes from the first to the last column
+        VISUALIZER_STATS_ADD(region_bytes, ((x + width - 1) / 8 - x / 8 + 1) * height);
+    }
+
+    dirty_regions_clear();
+
+    VISUALIZER_STATS_LCD_UPDATED();
+
+#ifdef EMULATOR
+    frame_number++;
+#endif
+}
+
+#ifdef EMULATOR
+uint32_t lcd_framebuffer_get_frame_number(void) {
+    return frame_number;
+}
+
+bool lcd_framebuffer_write_pbm(const char *const path) {
+    FILE *const file = fopen(path, "wb");
+    if (file == NULL) return false;
+
+    fprintf(file, "P4\n%d %d\n", LCD_WIDTH, LCD_HEIGHT);
+
+    // PBM uses the same packing, only with a set bit meaning black
+    const uint8_t *const bytes = (const uint8_t*)framebuffer;
+    for (uint16_t i = 0; i < sizeof(framebuffer); i++) {
+        fputc(bytes[i] ^ 0xff, file);
+    }
+
+    return fclose(file) == 0;
+}
+#endif
+
+#undef WORD_BITS
+#undef ROW_WORDS
+#undef MAX_SOURCE_ROW_BYTES
+#undef MAX_PAGE_ROW_BYTES
+#undef PAGE_HEIGHT
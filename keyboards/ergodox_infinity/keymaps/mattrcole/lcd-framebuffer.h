@@ -0,0 +1,57 @@
+#pragma once
+#include <stdint.h>
+#include "visualizer.h"
+#include "resources/resources.h"
+
+// amount of pixels per byte, same packing as the bitmaps in resources/
+#define LCD_FRAMEBUFFER_PIXELS_PER_BYTE 8
+#define LCD_FRAMEBUFFER_ROW_LENGTH (LCD_WIDTH / LCD_FRAMEBUFFER_PIXELS_PER_BYTE)
+#define LCD_FRAMEBUFFER_SIZE (LCD_FRAMEBUFFER_ROW_LENGTH * LCD_HEIGHT)
+
+/**
+ * Redraws the width x height area at (x, y) in a single pass.
+ *
+ * The source bitmap is placed with its upper left corner at
+ * (x + source_offset_x, y + source_offset_y). Every pixel of the area that
+ * the source doesn't cover is set to fill_color. A NULL source fills the
+ * whole area. The area is clipped to the screen.
+*/
+void lcd_framebuffer_compose(const int16_t x, const int16_t y, const int16_t width, const int16_t height, const int16_t source_offset_x, const int16_t source_offset_y, const resource_bitmap_t *const source, const gColor fill_color);
+
+// Same arguments as gdispGBlitArea, source must be a raw 1 bit per pixel
+// bitmap as described in "<root>/quantum/visualizer/resources/lcd_logo.c"
+void lcd_framebuffer_blit(const uint8_t x, const uint8_t y, const uint8_t width, const uint8_t height, const uint8_t source_x, const uint8_t source_y, const uint8_t source_row_length, const uint8_t *const source);
+
+void lcd_framebuffer_fill(const uint8_t x, const uint8_t y, const uint8_t width, const uint8_t height, const gColor color);
+
+/**
+ * Draws text with its upper left corner at (x, y), every glyph straight from
+ * the atlas of the font, and returns how wide it was. Characters the font
+ * has no glyph for are left out.
+*/
+int16_t lcd_framebuffer_draw_text(const int16_t x, const int16_t y, const char *text, const resource_font_t *const font);
+
+void lcd_framebuffer_clear(const gColor color);
+
+/**
+ * XORs a list of byte runs into the framebuffer.
+ *
+ * Every run is given as (bytes to skip, run length, run length bytes),
+ * counted from the end of the previous run, the first one from the first
+ * byte of the framebuffer. x, y, width and height is the area the runs
+ * change, it's what gets copied to the display driver.
+*/
+void lcd_framebuffer_apply_delta(const uint8_t *const runs, const uint16_t size, const uint8_t x, const uint8_t y, const uint8_t width, const uint8_t height);
+
+// Copies every region changed since the last flush into the display driver's
+// buffer, the visualizer thread's gdispGFlush() then sends it to the LCD
+void lcd_framebuffer_flush(void);
+
+#ifdef EMULATOR
+// amount of flushes that sent anything to the LCD so far
+uint32_t lcd_framebuffer_get_frame_number(void);
+
+// Writes the current contents of the framebuffer as a binary PBM image,
+// returns false if the file couldn't be written
+bool lcd_framebuffer_write_pbm(const char *const path);
+#endif
@@ -0,0 +1,12 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// The ergodox led functions only build the desired led state. This should be
+// called once at the end of every matrix scan, it hands the state to the
+// visualizer only if it differs from what was last handed over.
+void led_state_sync(void);
+
+// true if the leds should be left alone while the layer stays active, see
+// LayerDisplayPolicies in animation-keyframes.c
+bool led_state_is_paused(uint8_t layer);
@@ -0,0 +1,4 @@
+# The keymap draws its text from the font atlases in resources/ and gets the
+# uGFX fonts through visualizer_get_font_* only, so they needn't be opened at
+# startup, see visualizer.mk
+VISUALIZER_LAZY_FONTS = yes
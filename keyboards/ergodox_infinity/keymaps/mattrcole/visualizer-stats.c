@@ -0,0 +1,222 @@
+#include "visualizer-stats.h"
+
+#ifdef VISUALIZER_STATS_ENABLE
+
+#include <stdbool.h>
+#include <string.h>
+
+#ifdef EMULATOR
+#include <stdio.h>
+#endif
+
+visualizer_stats_t visualizer_stats;
+visualizer_latency_t visualizer_latency;
+
+// How far the last timed layer key got. The key is stamped by the matrix scan,
+// the other stages by the visualizer thread, which only moves them on with a
+// compare and swap, so a key stamped meanwhile is never lost.
+typedef enum {
+    LAYER_KEY_DONE,
+    LAYER_KEY_PRESSED,
+    LAYER_KEY_OBSERVED,   // seen by update_user_visualizer_state()
+    LAYER_KEY_APPLIED,    // its transition has started
+} LayerKeyStage;
+
+static volatile systemticks_t layer_key_time;
+static uint8_t layer_key_stage = LAYER_KEY_DONE;
+
+void visualizer_stats_init(void) {
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+    // the DWT needs the trace enable bit of the DEMCR first, then CYCCNTENA
+    *(volatile uint32_t *)0xE000EDFC |= 1UL << 24;
+    *(volatile uint32_t *)0xE0001000 |= 1UL;
+#endif
+
+    visualizer_stats_reset();
+    memset(&visualizer_latency, 0, sizeof(visualizer_latency));
+}
+
+void visualizer_stats_reset(void) {
+    memset(&visualizer_stats, 0, sizeof(visualizer_stats));
+}
+
+static void add_latency(uint16_t *const histogram, const systemticks_t latency) {
+    uint8_t bucket = 0;
+
+    while (bucket < VISUALIZER_STATS_LATENCY_BUCKETS - 1 && latency >= gfxMillisecondsToTicks(1UL << bucket)) bucket++;
+
+    if (histogram[bucket] < UINT16_MAX) histogram[bucket]++;
+}
+
+static bool advance_layer_key(const LayerKeyStage from, const LayerKeyStage to) {
+    uint8_t expected = from;
+
+    return __atomic_compare_exchange_n(&layer_key_stage, &expected, to, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+void visualizer_stats_layer_key(void) {
+    // still on its way to update_user_visualizer_state()
+    if (__atomic_load_n(&layer_key_stage, __ATOMIC_ACQUIRE) == LAYER_KEY_PRESSED) return;
+
+    layer_key_time = gfxSystemTicks();
+    __atomic_store_n(&layer_key_stage, LAYER_KEY_PRESSED, __ATOMIC_RELEASE);
+}
+
+void visualizer_stats_layer_observed(void) {
+    // the matrix scan leaves the time alone while the key is pressed
+    if (!advance_layer_key(LAYER_KEY_PRESSED, LAYER_KEY_OBSERVED)) return;
+
+    add_latency(visualizer_latency.key_to_state, gfxSystemTicks() - layer_key_time);
+}
+
+void visualizer_stats_layer_applied(void) {
+    advance_layer_key(LAYER_KEY_OBSERVED, LAYER_KEY_APPLIED);
+}
+
+void visualizer_stats_lcd_updated(void) {
+    const systemticks_t key_time = layer_key_time;
+
+    // a key pressed meanwhile already started over
+    if (!advance_layer_key(LAYER_KEY_APPLIED, LAYER_KEY_DONE)) return;
+
+    add_latency(visualizer_latency.key_to_lcd, gfxSystemTicks() - key_time);
+    visualizer_latency.samples++;
+}
+
+typedef struct {
+    char *position;
+    char *end;
+} StatsLine;
+
+static void append_text(StatsLine *const line, const char *text) {
+    while (*text != '\0' && line->position < line->end) *line->position++ = *text++;
+}
+
+static void append_number(StatsLine *const line, uint32_t number) {
+    char digits[10];
+    uint8_t count = 0;
+
+    do {
+        digits[count++] = '0' + number % 10;
+        number /= 10;
+    } while (number != 0);
+
+    while (count > 0 && line->position < line->end) *line->position++ = digits[--count];
+}
+
+static void append_counters(StatsLine *const line, const visualizer_stats_t *const s) {
+    append_text(line, "anim ");
+    append_number(line, s->animation_routine_calls);
+    append_text(line, "/");
+    append_number(line, s->animation_routine_time);
+    append_text(line, "/");
+    append_number(line, s->animation_routine_max_time);
+    append_text(line, " rst ");
+    append_number(line, s->animation_restarts);
+    append_text(line, " lag ");
+    append_number(line, s->animation_start_lag);
+    append_text(line, "/");
+    append_number(line, s->animation_start_max_lag);
+    append_text(line, " miss ");
+    append_number(line, s->missed_frames);
+    append_text(line, " blit ");
+    append_number(line, s->blits);
+    append_text(line, " fill ");
+    append_number(line, s->fills);
+    append_text(line, " px ");
+    append_number(line, s->pixels_drawn);
+    append_text(line, " flush ");
+    append_number(line, s->flushes);
+    append_text(line, " rgn ");
+    append_number(line, s->region_blits);
+    append_text(line, "/");
+    append_number(line, s->region_bytes);
+    append_text(line, " ud ");
+    append_number(line, s->user_data_sets);
+    append_text(line, "/");
+    append_number(line, s->user_data_skips);
+    append_text(line, "\n");
+}
+
+static void append_histogram(StatsLine *const line, const char *const name, const uint16_t *const histogram) {
+    append_text(line, name);
+    for (uint8_t bucket = 0; bucket < VISUALIZER_STATS_LATENCY_BUCKETS; bucket++) {
+        append_text(line, " ");
+        append_number(line, histogram[bucket]);
+    }
+    append_text(line, "\n");
+}
+
+// Avoids printf, which would pull a lot of code into the firmware
+void visualizer_stats_format(char *buffer, uint8_t size, visualizer_stats_line_t which) {
+    StatsLine line = { buffer, buffer + size - 1 };
+
+    switch (which) {
+        case VISUALIZER_STATS_KEY_TO_STATE:
+            append_histogram(&line, "key>state", visualizer_latency.key_to_state);
+            break;
+        case VISUALIZER_STATS_KEY_TO_LCD:
+            append_histogram(&line, "key>lcd", visualizer_latency.key_to_lcd);
+            break;
+        default:
+            append_counters(&line, &visualizer_stats);
+            break;
+    }
+
+    *line.position = '\0';
+}
+
+#ifdef EMULATOR
+static void print_latency(const char *const name, const uint16_t *const histogram) {
+    printf("latency %s", name);
+
+    for (uint8_t bucket = 0; bucket < VISUALIZER_STATS_LATENCY_BUCKETS - 1; bucket++) {
+        printf(" <%ums %u", 1u << bucket, histogram[bucket]);
+    }
+
+    printf(" longer %u\n", histogram[VISUALIZER_STATS_LATENCY_BUCKETS - 1]);
+}
+
+void visualizer_stats_print(void) {
+    const visualizer_stats_t *const s = &visualizer_stats;
+    static uint16_t printed_samples = 0;
+
+    // the histograms are kept for good, they're only printed when they change
+    if (visualizer_latency.samples != printed_samples) {
+        printed_samples = visualizer_latency.samples;
+        print_latency("key>state", visualizer_latency.key_to_state);
+        print_latency("key>lcd  ", visualizer_latency.key_to_lcd);
+    }
+
+    // nothing happened since the last print, don't spam the output
+    if (s->animation_routine_calls == 0 && s->flushes == 0) return;
+
+    printf("animation calls %lu time %lu max %lu restarts %lu lag %lu max %lu missed %lu | user data %lu skipped %lu | blits %lu fills %lu pixels %lu | deltas %lu bytes %lu | flushes %lu region blits %lu pixels %lu bytes %lu | led scans %lu time %lu max %lu paused %lu\n",
+        (unsigned long)s->animation_routine_calls,
+        (unsigned long)s->animation_routine_time,
+        (unsigned long)s->animation_routine_max_time,
+        (unsigned long)s->animation_restarts,
+        (unsigned long)s->animation_start_lag,
+        (unsigned long)s->animation_start_max_lag,
+        (unsigned long)s->missed_frames,
+        (unsigned long)s->user_data_sets,
+        (unsigned long)s->user_data_skips,
+        (unsigned long)s->blits,
+        (unsigned long)s->fills,
+        (unsigned long)s->pixels_drawn,
+        (unsigned long)s->deltas,
+        (unsigned long)s->delta_bytes,
+        (unsigned long)s->flushes,
+        (unsigned long)s->region_blits,
+        (unsigned long)s->region_pixels,
+        (unsigned long)s->region_bytes,
+        (unsigned long)s->led_scans,
+        (unsigned long)s->led_scan_time,
+        (unsigned long)s->led_scan_max_time,
+        (unsigned long)s->led_scans_paused);
+
+    visualizer_stats_reset();
+}
+#endif
+
+#endif
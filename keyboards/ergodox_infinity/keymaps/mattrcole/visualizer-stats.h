@@ -0,0 +1,134 @@
+#pragma once
+#include <stdint.h>
+#include "gfx.h"
+
+/**
+ * Counters for what the LCD animations cost.
+ *
+ * Only compiled in when VISUALIZER_STATS_ENABLE is defined (emulator builds
+ * always define it, VISUALIZER_STATS = yes in rules.mk does on the board),
+ * otherwise every macro below expands to nothing.
+*/
+
+#ifdef VISUALIZER_STATS_ENABLE
+
+typedef struct {
+    uint32_t animation_routine_calls;
+    uint32_t animation_routine_time;     // total, in VISUALIZER_STATS_CLOCK() units
+    uint32_t animation_routine_max_time;
+    uint32_t animation_restarts;         // current_animation started over towards a new layer
+    uint32_t animation_start_lag;        // ticks animations were behind their start, caught up by skipping steps
+    uint32_t animation_start_max_lag;
+    uint32_t missed_frames;              // animation frames the visualizer thread woke up too late for
+    uint32_t user_data_sets;             // visualizer_set_user_data calls
+    uint32_t user_data_skips;            // led_state_sync calls that had nothing new to hand over
+    uint32_t blits;                      // framebuffer draws with a bitmap
+    uint32_t fills;                      // framebuffer draws without a bitmap
+    uint32_t pixels_drawn;               // framebuffer pixels written by the above
+    uint32_t deltas;                     // precomputed deltas applied to the framebuffer
+    uint32_t delta_bytes;
+    uint32_t flushes;                    // flushes that copied anything, each one a whole frame over SPI
+    uint32_t region_blits;               // gdispGBlitArea calls into the display driver's buffer
+    uint32_t region_pixels;
+    uint32_t region_bytes;
+    uint32_t led_scans;                  // matrix scans that updated the leds
+    uint32_t led_scan_time;
+    uint32_t led_scan_max_time;
+    uint32_t led_scans_paused;           // matrix scans that left them alone, see LayerDisplayPolicies
+} visualizer_stats_t;
+
+extern visualizer_stats_t visualizer_stats;
+
+/**
+ * Histograms of how long a layer change takes, from the layer key being
+ * handled by the matrix scan, to update_user_visualizer_state() seeing the
+ * new layer, and to the first flush after the layer was applied. Layers are
+ * only applied once per FRAME_TIME, until then the flushes still belong to the
+ * previous change.
+ *
+ * Bucket n counts the latencies below 2^n ms, the last one all longer ones.
+ * A layer key pressed while the previous one is still on its way to
+ * update_user_visualizer_state() isn't timed on its own, so a burst is
+ * measured from its first key. A key pressed after that, but before the
+ * change reached the LCD, drops the previous sample and starts a new one.
+*/
+#define VISUALIZER_STATS_LATENCY_BUCKETS 10
+
+typedef struct {
+    uint16_t key_to_state[VISUALIZER_STATS_LATENCY_BUCKETS];
+    uint16_t key_to_lcd[VISUALIZER_STATS_LATENCY_BUCKETS];
+    uint16_t samples;
+} visualizer_latency_t;
+
+extern visualizer_latency_t visualizer_latency;
+
+#ifndef VISUALIZER_STATS_CLOCK
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+// the DWT cycle counter of the Cortex-M3/M4, started by visualizer_stats_init()
+#define VISUALIZER_STATS_CLOCK() (*(volatile uint32_t *)0xE0001004)
+#else
+#define VISUALIZER_STATS_CLOCK() ((uint32_t)gfxSystemTicks())
+#endif
+#endif
+
+#define VISUALIZER_STATS_ADD(counter, amount) (visualizer_stats.counter += (amount))
+#define VISUALIZER_STATS_INCREMENT(counter) VISUALIZER_STATS_ADD(counter, 1)
+#define VISUALIZER_STATS_MAX(counter, value) \
+    do { \
+        if ((value) > visualizer_stats.counter) visualizer_stats.counter = (value); \
+    } while (0)
+
+#define VISUALIZER_STATS_LAYER_KEY() visualizer_stats_layer_key()
+#define VISUALIZER_STATS_LAYER_OBSERVED() visualizer_stats_layer_observed()
+#define VISUALIZER_STATS_LAYER_APPLIED() visualizer_stats_layer_applied()
+#define VISUALIZER_STATS_LCD_UPDATED() visualizer_stats_lcd_updated()
+
+#define VISUALIZER_STATS_TIMER_START(timer) const uint32_t timer = VISUALIZER_STATS_CLOCK()
+#define VISUALIZER_STATS_TIMER_STOP(timer, total, max) \
+    do { \
+        const uint32_t elapsed = VISUALIZER_STATS_CLOCK() - (timer); \
+        visualizer_stats.total += elapsed; \
+        if (elapsed > visualizer_stats.max) visualizer_stats.max = elapsed; \
+    } while (0)
+
+void visualizer_stats_init(void);
+void visualizer_stats_reset(void);
+
+void visualizer_stats_layer_key(void);
+void visualizer_stats_layer_observed(void);
+void visualizer_stats_layer_applied(void);
+void visualizer_stats_lcd_updated(void);
+
+// The lines of text visualizer_stats_format() writes, for SEND_STRING
+typedef enum {
+    VISUALIZER_STATS_COUNTERS,
+    VISUALIZER_STATS_KEY_TO_STATE,
+    VISUALIZER_STATS_KEY_TO_LCD,
+    VISUALIZER_STATS_LINES
+} visualizer_stats_line_t;
+
+// Fits the longest of them, the counters with every one of their 15 numbers
+// at the 10 digits of UINT32_MAX, and the terminating zero
+#define VISUALIZER_STATS_LINE_SIZE (sizeof("anim // rst  lag / miss  blit  fill  px  flush  rgn / ud /\n") + 15 * 10)
+
+// writes a line of the counters, shorter buffers cut it off
+void visualizer_stats_format(char *buffer, uint8_t size, visualizer_stats_line_t which);
+
+#ifdef EMULATOR
+// prints the counters as a single line, then resets them
+void visualizer_stats_print(void);
+#endif
+
+#else
+
+#define VISUALIZER_STATS_ADD(counter, amount) ((void)0)
+#define VISUALIZER_STATS_INCREMENT(counter) ((void)0)
+#define VISUALIZER_STATS_MAX(counter, value) ((void)0)
+#define VISUALIZER_STATS_LAYER_KEY() ((void)0)
+#define VISUALIZER_STATS_LAYER_OBSERVED() ((void)0)
+#define VISUALIZER_STATS_LAYER_APPLIED() ((void)0)
+#define VISUALIZER_STATS_LCD_UPDATED() ((void)0)
+#define VISUALIZER_STATS_TIMER_START(timer)
+#define VISUALIZER_STATS_TIMER_STOP(timer, total, max) ((void)0)
+
+#endif
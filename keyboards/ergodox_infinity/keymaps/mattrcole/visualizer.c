@@ -27,21 +27,69 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #error This visualizer needs that LCD is enabled
 #endif
 
+#include <string.h>
+
+#ifdef EMULATOR
+#include <stdio.h>
+#endif
+
 #include "resources/resources.h"
 #include "visualizer.h"
 #include "visualizer_keyframes.h"
 #include "lcd_keyframes.h"
 #include "lcd_backlight_keyframes.h"
+#ifdef BACKLIGHT_ENABLE
+#include "led_backlight_keyframes.h"
+#endif
 #include "system/serial_link.h"
 #include "default_animations.h"
 #include "util.h"
 #include "layers.h"
 #include "animation-keyframes.h"
+#include "led-state.h"
+#include "visualizer-stats.h"
+#include "lcd-framebuffer.h"
 
 static bool first_state_update = true;
 
 bool led_backlight_keyframe_fade_in_all(keyframe_animation_t* animation, visualizer_state_t* state);
 
+// Same as default_suspend_animation, except that the text is drawn from the
+// font atlas in resources/ instead of with the uGFX font
+static bool keyframe_draw_layer_text(keyframe_animation_t* animation, visualizer_state_t* state) {
+    (void)animation;
+
+    lcd_framebuffer_clear(White);
+    lcd_framebuffer_draw_text(0, 10, state->layer_text, &resource_font_dejavusansbold12);
+
+    return false;
+}
+
+static bool keyframe_fade_out(keyframe_animation_t* animation, visualizer_state_t* state) {
+    bool ret = false;
+    ret |= lcd_backlight_keyframe_animate_color(animation, state);
+#ifdef BACKLIGHT_ENABLE
+    ret |= led_backlight_keyframe_fade_out_all(animation, state);
+#endif
+    return ret;
+}
+
+static bool keyframe_disable(keyframe_animation_t* animation, visualizer_state_t* state) {
+    lcd_keyframe_disable(animation, state);
+    lcd_backlight_keyframe_disable(animation, state);
+#ifdef BACKLIGHT_ENABLE
+    led_backlight_keyframe_disable(animation, state);
+#endif
+    return false;
+}
+
+static keyframe_animation_t suspend_animation = {
+    .num_frames = 3,
+    .loop = false,
+    .frame_lengths = {0, gfxMillisecondsToTicks(1000), 0},
+    .frame_functions = {keyframe_draw_layer_text, keyframe_fade_out, keyframe_disable},
+};
+
 static keyframe_animation_t color_animation = {
     .num_frames = 2,
     .loop = false,
@@ -108,6 +156,24 @@ typedef enum {
 
 static lcd_state_t lcd_state = LCD_STATE_INITIAL;
 
+// Layer changes come in bursts, tapping keys while holding MO(FN_LAYER) for
+// example. The animations are retargeted at most once per FRAME_TIME, to the
+// newest layer, the ones in between would never be seen anyway.
+static Layers applied_layer;
+static Layers pending_layer;
+static bool layer_change_pending = false;
+static systemticks_t last_layer_change;
+
+static bool keyframe_apply_pending_layer(keyframe_animation_t* animation, visualizer_state_t* state);
+
+// Waits out the rest of the FRAME_TIME since the last layer change
+static keyframe_animation_t layer_change_animation = {
+    .num_frames = 2,
+    .loop = false,
+    .frame_lengths = {0, 0},
+    .frame_functions = {keyframe_no_operation, keyframe_apply_pending_layer},
+};
+
 typedef struct {
     uint8_t led_on;
     uint8_t led1;
@@ -123,10 +189,53 @@ static visualizer_user_data_t user_data_keyboard = {
     .led3 = LED_BRIGHTNESS_HI,
 };
 
+// The user data that was last handed to the visualizer. The ergodox led
+// functions below only modify user_data_keyboard, led_state_sync() decides if
+// it has to be published
+static visualizer_user_data_t user_data_published;
+static bool user_data_is_published = false;
+
 _Static_assert(sizeof(visualizer_user_data_t) <= VISUALIZER_USER_DATA_SIZE,
     "Please increase the VISUALIZER_USER_DATA_SIZE");
 
+#ifdef EMULATOR
+// Called after every update of the visualizer thread, reports what the
+// animations cost during that update. Define VISUALIZER_CAPTURE_FRAMES as a
+// directory to also get every frame sent to the LCD as a numbered PBM image.
+void draw_emulator(void) {
+    visualizer_stats_print();
+
+#ifdef VISUALIZER_CAPTURE_FRAMES
+    static uint32_t captured_frame_number = 0;
+    const uint32_t frame_number = lcd_framebuffer_get_frame_number();
+
+    if (frame_number != captured_frame_number) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s/frame-%05lu.pbm", VISUALIZER_CAPTURE_FRAMES, (unsigned long)frame_number);
+        lcd_framebuffer_write_pbm(path);
+        captured_frame_number = frame_number;
+    }
+#endif
+}
+#endif
+
+// The animations only draw into the framebuffer, this copies whatever they
+// changed during an update of the visualizer to the display driver, which the
+// visualizer thread then sends to the LCD in one go
+void user_visualizer_flush(visualizer_state_t* state) {
+    (void)state;
+    lcd_framebuffer_flush();
+}
+
 void initialize_user_visualizer(visualizer_state_t* state) {
+#ifdef VISUALIZER_STATS_ENABLE
+    visualizer_stats_init();
+#endif
+
+    // Only the layer is shown. Without this, every mod tap and every change
+    // of the leds in the user data would wake the visualizer up for nothing.
+    visualizer_set_subscriptions(VISUALIZER_STATUS_LAYER);
+
     // The brightness will be dynamically adjustable in the future
     // But for now, change it here.
     lcd_backlight_brightness(130);
@@ -140,10 +249,7 @@ static inline bool is_led_on(visualizer_user_data_t* user_data, uint8_t num) {
     return user_data->led_on & (1u << num);
 }
 
-void initialize_my_animation_handler(Layers);
-void update_my_animation_handler(Layers);
-
-void update_user_visualizer_state(visualizer_state_t* state, visualizer_keyboard_status_t* prev_status) {
+static void update_layer_color(visualizer_state_t* state, Layers layer) {
     // const uint8_t OrangeYellow = 30;
     // const uint8_t GreenBlueGreen = 90;
     // const uint8_t Aqua = 120;
@@ -158,17 +264,6 @@ void update_user_visualizer_state(visualizer_state_t* state, visualizer_keyboard
     const uint8_t _Purple = 200;
     const uint8_t saturation = 255;
 
-    uint8_t layer = biton32(state->status.layer);
-    uint8_t previous_layer = biton32(prev_status->layer);
-
-    if (layer == previous_layer && !first_state_update) return;
-
-    if (first_state_update) {
-        first_state_update = false;
-        initialize_my_animation_handler((Layers)layer);
-    }
-    else update_my_animation_handler((Layers)layer);
-
     switch(layer) {
         case WIN_LAYOUT:
             state->target_lcd_color = LCD_COLOR(_Blue, saturation, 0xFF);
@@ -184,13 +279,85 @@ void update_user_visualizer_state(visualizer_state_t* state, visualizer_keyboard
             break;
         case FN_LAYER:
             state->target_lcd_color = LCD_COLOR(_Purple, saturation, 0xFF);
+            break;
         default:
             state->target_lcd_color = LCD_COLOR(80, 0, 0xFF);
             break;
     }
 
+    // also when called from layer_change_animation, outside of the state update
+    state->prev_lcd_color = state->current_lcd_color;
+
+    if (get_layer_display_policy(layer)->transition == SNAP) {
+        stop_keyframe_animation(&color_animation);
+        state->current_lcd_color = state->target_lcd_color;
+        lcd_backlight_color(LCD_HUE(state->current_lcd_color), LCD_SAT(state->current_lcd_color), LCD_INT(state->current_lcd_color));
+        return;
+    }
+
     start_keyframe_animation(&color_animation);
+}
+
+// start is when the layer change should be seen to happen, on both halves
+static void apply_layer(visualizer_state_t* state, Layers layer, systemticks_t start) {
+    if (layer == applied_layer) return;
+
+    applied_layer = layer;
+    last_layer_change = start;
+    update_my_animation_handler(layer, start);
+    update_layer_color(state, layer);
+
+    VISUALIZER_STATS_LAYER_APPLIED();
+}
+
+static bool keyframe_apply_pending_layer(keyframe_animation_t* animation, visualizer_state_t* state) {
+    (void)animation;
+
+    layer_change_pending = false;
+    // when the delay ran out, even if this half got to it a bit later
+    apply_layer(state, pending_layer, last_layer_change + gfxMillisecondsToTicks(FRAME_TIME));
+
+    return false;
+}
+
+void update_user_visualizer_state(visualizer_state_t* state, visualizer_keyboard_status_t* prev_status) {
+    Layers layer = biton32(state->status.layer);
+    Layers previous_layer = biton32(prev_status->layer);
+
+    // Turning a layer on or off below the top one doesn't change anything
+    if (layer == previous_layer && !first_state_update) return;
+
+    VISUALIZER_STATS_LAYER_OBSERVED();
 
+    if (first_state_update) {
+        first_state_update = false;
+        layer_change_pending = false;
+        applied_layer = layer;
+        last_layer_change = state->status_time;
+        initialize_my_animation_handler(layer);
+        update_layer_color(state, layer);
+        VISUALIZER_STATS_LAYER_APPLIED();
+        return;
+    }
+
+    pending_layer = layer;
+
+    if (layer_change_pending) return;
+
+    // Both are times of the master, so the halves coalesce alike
+    const systemticks_t since_last_change = state->status_time - last_layer_change;
+
+    if (since_last_change >= gfxMillisecondsToTicks(FRAME_TIME)) {
+        apply_layer(state, layer, state->status_time);
+        return;
+    }
+
+    layer_change_pending = true;
+    const systemticks_t delay_end = last_layer_change + gfxMillisecondsToTicks(FRAME_TIME);
+    const systemticks_t now = gfxSystemTicks();
+    // a slave can learn about the change after the delay already ran out
+    layer_change_animation.frame_lengths[0] = (int32_t)(delay_end - now) > 0 ? delay_end - now : 0;
+    start_keyframe_animation(&layer_change_animation);
 }
 
 void user_visualizer_suspend(visualizer_state_t* state) {
@@ -198,7 +365,7 @@ void user_visualizer_suspend(visualizer_state_t* state) {
     uint8_t hue = LCD_HUE(state->current_lcd_color);
     uint8_t sat = LCD_SAT(state->current_lcd_color);
     state->target_lcd_color = LCD_COLOR(hue, sat, 0);
-    start_keyframe_animation(&default_suspend_animation);
+    start_keyframe_animation(&suspend_animation);
 }
 
 void user_visualizer_resume(visualizer_state_t* state) {
@@ -215,17 +382,14 @@ void ergodox_board_led_on(void){
 
 void ergodox_right_led_1_on(void){
     user_data_keyboard.led_on |= (1u << 0);
-    visualizer_set_user_data(&user_data_keyboard);
 }
 
 void ergodox_right_led_2_on(void){
     user_data_keyboard.led_on |= (1u << 1);
-    visualizer_set_user_data(&user_data_keyboard);
 }
 
 void ergodox_right_led_3_on(void){
     user_data_keyboard.led_on |= (1u << 2);
-    visualizer_set_user_data(&user_data_keyboard);
 }
 
 void ergodox_board_led_off(void){
@@ -234,30 +398,40 @@ void ergodox_board_led_off(void){
 
 void ergodox_right_led_1_off(void){
     user_data_keyboard.led_on &= ~(1u << 0);
-    visualizer_set_user_data(&user_data_keyboard);
 }
 
 void ergodox_right_led_2_off(void){
     user_data_keyboard.led_on &= ~(1u << 1);
-    visualizer_set_user_data(&user_data_keyboard);
 }
 
 void ergodox_right_led_3_off(void){
     user_data_keyboard.led_on &= ~(1u << 2);
-    visualizer_set_user_data(&user_data_keyboard);
 }
 
 void ergodox_right_led_1_set(uint8_t n) {
     user_data_keyboard.led1 = n;
-    visualizer_set_user_data(&user_data_keyboard);
 }
 
 void ergodox_right_led_2_set(uint8_t n) {
     user_data_keyboard.led2 = n;
-    visualizer_set_user_data(&user_data_keyboard);
 }
 
 void ergodox_right_led_3_set(uint8_t n) {
     user_data_keyboard.led3 = n;
+}
+
+void led_state_sync(void) {
+    if (user_data_is_published && memcmp(&user_data_published, &user_data_keyboard, sizeof(visualizer_user_data_t)) == 0) {
+        VISUALIZER_STATS_INCREMENT(user_data_skips);
+        return;
+    }
+
+    user_data_published = user_data_keyboard;
+    user_data_is_published = true;
     visualizer_set_user_data(&user_data_keyboard);
+    VISUALIZER_STATS_INCREMENT(user_data_sets);
+}
+
+bool led_state_is_paused(uint8_t layer) {
+    return get_layer_display_policy((Layers)layer)->pause_leds;
 }
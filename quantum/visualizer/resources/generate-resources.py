@@ -0,0 +1,927 @@
+#!/usr/bin/env python3
+"""
+Converts a directory of PBM/PNG images into resources.c and resources.h
+
+Every image becomes a resource_bitmap_t named after its file, so
+images/logo-win.pbm turns into resource_logo_win. Images are converted to
+the 1 bit per pixel format described in "lcd_logo.c", dark pixels being
+black and light ones white, and are stored PackBits compressed whenever
+that saves at least a quarter of the raw size.
+
+Every image is also emitted a second time as resource_<name>_pages, in
+the page order of the LCD controller, so the ElementResourceMap can pick
+either one. The linker drops whichever variant isn't used.
+
+Images with identical content are stored once, every other name is
+defined as an alias of the first one. That way both names point at the
+very same resource and compare equal.
+
+When --elements is given, the element bounding boxes and the
+ElementResourceMap are read from that animation-keyframes.c and every
+image used by an element has to be exactly the size of its bounding box.
+
+--deltas additionally renders every element with each of its images at
+every frame of its motion curve and writes the XOR differences between
+neighboring frames to the given header, see ElementDeltas in
+animation-keyframes.c.
+
+--fonts turns every PBM/PNG glyph sheet in the given directory into a
+resource_font_<name>, a raw bitmap atlas of its glyphs and their positions
+in it. The first row of a sheet has a dark pixel in the first column of
+every glyph, and a '# characters: "..."' comment lists their characters in
+the same order. With --text only the characters of the layer_text strings
+of that source file are kept, and every one of them has to be in each font.
+
+Usage: generate-resources.py [--elements animation-keyframes.c [--deltas element-deltas.h]]
+                             [--fonts <font dir> [--text visualizer.c]] <image dir> <output dir>
+"""
+
+import argparse
+import hashlib
+import os
+import re
+import struct
+import sys
+import zlib
+
+# page ordered resources can't be wider than the screen
+LCD_WIDTH = 128
+
+# PackBits is only used if the compressed data is at most this much of the raw data
+PACKBITS_MAX_RATIO = 0.75
+
+
+class ResourceError(Exception):
+    pass
+
+
+class Image:
+    def __init__(self, name, path, width, height, pixels):
+        self.name = name
+        self.path = path
+        self.width = width
+        self.height = height
+        # one bool per pixel, row by row, True being white
+        self.pixels = pixels
+
+    def to_raw(self):
+        row_bytes = (self.width + 7) // 8
+        data = bytearray(row_bytes * self.height)
+        for y in range(self.height):
+            for x in range(self.width):
+                if self.pixels[y * self.width + x]:
+                    data[y * row_bytes + x // 8] |= 0x80 >> (x % 8)
+        return bytes(data)
+
+    def to_pages(self):
+        data = bytearray(self.width * ((self.height + 7) // 8))
+        for y in range(self.height):
+            for x in range(self.width):
+                if self.pixels[y * self.width + x]:
+                    data[y // 8 * self.width + x] |= 1 << (y % 8)
+        return bytes(data)
+
+
+# PBM ===========================================================================================================================
+
+def read_pbm_tokens(data, count, position):
+    tokens = []
+    while len(tokens) < count:
+        while position < len(data) and (chr(data[position]).isspace() or data[position] == ord('#')):
+            if data[position] == ord('#'):
+                while position < len(data) and data[position] not in b'\r\n':
+                    position += 1
+            else:
+                position += 1
+        start = position
+        while position < len(data) and not chr(data[position]).isspace() and data[position] != ord('#'):
+            position += 1
+        if start == position:
+            raise ResourceError('unexpected end of file')
+        tokens.append(data[start:position].decode('ascii'))
+    return tokens, position
+
+
+def read_pbm(data):
+    (magic, width, height), position = read_pbm_tokens(data, 3, 0)
+    width, height = int(width), int(height)
+
+    if magic == 'P1':
+        bits = [c for c in data[position:].decode('ascii') if c in '01']
+        if len(bits) < width * height:
+            raise ResourceError('not enough pixels')
+        # PBM uses 1 for black
+        return width, height, [bit == '0' for bit in bits[:width * height]]
+
+    if magic == 'P4':
+        # exactly one whitespace character follows the header
+        raster = data[position + 1:]
+        row_bytes = (width + 7) // 8
+        if len(raster) < row_bytes * height:
+            raise ResourceError('not enough pixels')
+        return width, height, [
+            not raster[y * row_bytes + x // 8] & (0x80 >> (x % 8))
+            for y in range(height) for x in range(width)
+        ]
+
+    raise ResourceError('only P1 and P4 PBM files are supported')
+
+
+# PNG ===========================================================================================================================
+
+PNG_SIGNATURE = b'\x89PNG\r\n\x1a\n'
+
+# samples per pixel for every PNG color type
+PNG_CHANNELS = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}
+
+
+def unfilter_png(raw, row_bytes, pixel_bytes, height):
+    rows = []
+    previous = bytearray(row_bytes)
+    position = 0
+    for _ in range(height):
+        filter_type = raw[position]
+        row = bytearray(raw[position + 1:position + 1 + row_bytes])
+        position += 1 + row_bytes
+        for i in range(row_bytes):
+            left = row[i - pixel_bytes] if i >= pixel_bytes else 0
+            up = previous[i]
+            up_left = previous[i - pixel_bytes] if i >= pixel_bytes else 0
+            if filter_type == 1:
+                row[i] = (row[i] + left) & 0xff
+            elif filter_type == 2:
+                row[i] = (row[i] + up) & 0xff
+            elif filter_type == 3:
+                row[i] = (row[i] + (left + up) // 2) & 0xff
+            elif filter_type == 4:
+                estimate = left + up - up_left
+                distances = (abs(estimate - left), abs(estimate - up), abs(estimate - up_left))
+                row[i] = (row[i] + (left, up, up_left)[distances.index(min(distances))]) & 0xff
+            elif filter_type != 0:
+                raise ResourceError('unknown PNG filter %d' % filter_type)
+        rows.append(row)
+        previous = row
+    return rows
+
+
+def read_png(data):
+    if not data.startswith(PNG_SIGNATURE):
+        raise ResourceError('not a PNG file')
+
+    position = len(PNG_SIGNATURE)
+    header = None
+    palette = []
+    compressed = b''
+    while position < len(data):
+        length, chunk_type = struct.unpack('>I4s', data[position:position + 8])
+        chunk = data[position + 8:position + 8 + length]
+        position += 12 + length
+        if chunk_type == b'IHDR':
+            header = struct.unpack('>IIBBBBB', chunk)
+        elif chunk_type == b'PLTE':
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif chunk_type == b'IDAT':
+            compressed += chunk
+        elif chunk_type == b'IEND':
+            break
+
+    if header is None:
+        raise ResourceError('missing PNG header')
+
+    width, height, depth, color_type, _, _, interlace = header
+    if interlace:
+        raise ResourceError('interlaced PNG files are not supported')
+    if color_type not in PNG_CHANNELS or depth > 8 and depth != 16:
+        raise ResourceError('unsupported PNG color type %d' % color_type)
+
+    channels = PNG_CHANNELS[color_type]
+    bits_per_pixel = channels * depth
+    row_bytes = (width * bits_per_pixel + 7) // 8
+    rows = unfilter_png(zlib.decompress(compressed), row_bytes, max(1, bits_per_pixel // 8), height)
+
+    def sample(row, index):
+        if depth == 16:
+            return row[index * 2]
+        if depth == 8:
+            return row[index]
+        bit = index * depth
+        value = (row[bit // 8] >> (8 - depth - bit % 8)) & ((1 << depth) - 1)
+        # palette indices are used as they are, gray levels are scaled up to 8 bits
+        return value if color_type == 3 else value * 255 // ((1 << depth) - 1)
+
+    pixels = []
+    for row in rows:
+        for x in range(width):
+            if color_type == 3:
+                red, green, blue = palette[sample(row, x)]
+            elif color_type in (0, 4):
+                red = green = blue = sample(row, x * channels)
+            else:
+                red, green, blue = (sample(row, x * channels + i) for i in range(3))
+            # alpha is ignored, same as the "Edge 128" conversion used before
+            pixels.append((red * 299 + green * 587 + blue * 114) // 1000 >= 128)
+    return width, height, pixels
+
+
+# PACKBITS ======================================================================================================================
+
+def packbits(data):
+    """Compresses data as described in resource_format_t"""
+    output = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 2:
+            output += bytes((257 - run, data[i]))
+            i += run
+            continue
+        literal = bytearray()
+        while i < len(data) and len(literal) < 128:
+            if i + 2 < len(data) and data[i] == data[i + 1] == data[i + 2]:
+                break
+            if i + 2 == len(data) and data[i] == data[i + 1]:
+                break
+            literal.append(data[i])
+            i += 1
+        output.append(len(literal) - 1)
+        output += literal
+    return bytes(output)
+
+
+def unpackbits(data):
+    output = bytearray()
+    i = 0
+    while i < len(data):
+        header = data[i]
+        i += 1
+        if header < 128:
+            output += data[i:i + header + 1]
+            i += header + 1
+        elif header > 128:
+            output += bytes((data[i],)) * (257 - header)
+            i += 1
+    return bytes(output)
+
+
+# FONTS =========================================================================================================================
+
+class Font:
+    def __init__(self, name, path, glyphs, atlas):
+        self.name = name
+        self.path = path
+        # (character, first column in the atlas, width) sorted by character
+        self.glyphs = glyphs
+        self.atlas = atlas
+
+    def keep(self, characters):
+        """Returns the font with only the given characters, their glyphs packed side by side"""
+        glyphs = []
+        columns = []
+        for character, x, width in self.glyphs:
+            if character in characters:
+                glyphs.append((character, len(columns), width))
+                columns.extend(range(x, x + width))
+
+        atlas = Image(self.atlas.name, self.path, len(columns), self.atlas.height, [
+            self.atlas.pixels[y * self.atlas.width + x] for y in range(self.atlas.height) for x in columns
+        ])
+        return Font(self.name, self.path, glyphs, atlas)
+
+
+def read_font(path):
+    sheet = read_image(path)
+    with open(path, 'rb') as file:
+        match = re.search(rb'^# characters: "(.*)"\s*$', file.read(), re.M)
+    if match is None:
+        raise ResourceError('%s: no \'# characters: "..."\' comment' % path)
+    characters = match.group(1).decode('ascii')
+
+    starts = [x for x in range(sheet.width) if not sheet.pixels[x]]
+    if len(starts) != len(characters):
+        raise ResourceError('%s: %d glyphs marked in the first row, but %d characters' % (path, len(starts), len(characters)))
+    if not starts or starts[0] != 0:
+        raise ResourceError('%s: the first glyph has to start in the first column' % path)
+    if len(set(characters)) != len(characters):
+        raise ResourceError('%s: characters appear more than once' % path)
+
+    ends = starts[1:] + [sheet.width]
+    glyphs = sorted((character, start, end - start) for character, start, end in zip(characters, starts, ends))
+    atlas = Image('font_' + sheet.name, path, sheet.width, sheet.height - 1, sheet.pixels[sheet.width:])
+    return Font(sheet.name, path, glyphs, atlas)
+
+
+def read_text_characters(path):
+    """Returns the characters of every layer_text string in the source file"""
+    with open(path) as file:
+        source = file.read()
+    characters = set()
+    for text in re.findall(r'layer_text\s*=\s*"((?:[^"\\]|\\.)*)"', source):
+        characters.update(bytes(text, 'ascii').decode('unicode_escape'))
+    return characters
+
+
+# ELEMENTS ======================================================================================================================
+
+class Element:
+    def __init__(self, name, axis, direction, box, steps):
+        self.name = name
+        self.axis = axis
+        self.direction = direction
+        # x0, y0, x1, y1, inclusive
+        self.box = box
+        # (offset, previous offset) of every frame of the motion curve
+        self.steps = steps
+
+    @property
+    def offsets(self):
+        return [offset for offset, _ in self.steps]
+
+    @property
+    def width(self):
+        return self.box[2] - self.box[0] + 1
+
+    @property
+    def height(self):
+        return self.box[3] - self.box[1] + 1
+
+
+class Elements:
+    """What read_elements() finds in animation-keyframes.c"""
+
+    def __init__(self, elements, resource_map, total_frames, erase_white, curves):
+        # in ElementList order
+        self.elements = elements
+        # one list per layer, in ElementList order, None where the map has NULL
+        self.resource_map = resource_map
+        self.total_frames = total_frames
+        self.erase_white = erase_white
+        # the raw (offset, previous offset) steps of every motion curve
+        self.curves = curves
+
+    def sizes(self):
+        """Returns {resource name: (element, width, height)} for every resource used by an element"""
+        sizes = {}
+        for row in self.resource_map:
+            for element, resource in zip(self.elements, row):
+                if resource is not None:
+                    sizes[resource] = (element.name, element.width, element.height)
+        return sizes
+
+
+def read_elements(path):
+    with open(path) as file:
+        source = file.read()
+
+    def find(pattern, what, flags=0):
+        match = re.search(pattern, source, flags)
+        if match is None:
+            raise ResourceError('%s: %s not found' % (path, what))
+        return match
+
+    element_names = find(r'typedef enum \{([^}]*)\} ElementList;', 'ElementList').group(1)
+    element_names = [name.strip() for name in element_names.split(',') if name.strip() != 'TOTAL_ELEMENTS']
+    resource_map = find(r'ElementResourceMap\[[^\]]*\]\[[^\]]*\]\s*=\s*\{(.*?)\n\};', 'ElementResourceMap', re.S).group(1)
+    total_frames = int(find(r'#define\s+TOTAL_FRAMES\s+(\d+)', 'TOTAL_FRAMES').group(1))
+    resting = int(find(r'#define\s+RESTING\s+(\d+)', 'RESTING').group(1))
+    erase_color = find(r'ScreenEraseColor\s*=\s*(\w+)', 'ScreenEraseColor').group(1)
+
+    curves = {}
+    for match in re.finditer(r'#define\s+(\w+)_STEPS\(STEP, \.\.\.\)((?:.*\\\n)*.*)', source):
+        curves[match.group(1)] = [
+            tuple(resting if value == 'RESTING' else int(value) for value in step)
+            for step in re.findall(r'STEP\((\w+),\s*(\w+),', match.group(2))
+        ]
+
+    elements = {}
+    for match in re.finditer(r'#define\s+\w+_PROPERTIES\s+(\w+),\s*(\w+),\s*(\w+),\s*(\w+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+)', source):
+        name, axis, curve, direction = match.group(1, 2, 3, 4)
+        if curve not in curves:
+            raise ResourceError('%s: motion curve %s of %s not found' % (path, curve, name))
+        elements[name] = Element(name, axis, direction, tuple(map(int, match.group(5, 6, 7, 8))), curves[curve])
+
+    missing = [name for name in element_names if name not in elements]
+    if missing:
+        raise ResourceError('%s: no properties for %s' % (path, ', '.join(missing)))
+
+    rows = []
+    for row in re.findall(r'\{([^{}]*)\}', resource_map):
+        entries = [entry.strip().lstrip('&') for entry in row.split(',')]
+        rows.append([None if entry == 'NULL' else entry for entry in entries])
+
+    return Elements([elements[name] for name in element_names], rows, total_frames, erase_color != 'Black', curves)
+
+
+# ELEMENT DELTAS ================================================================================================================
+
+DELTAS_NOTICE = """/**
+ * Generated by generate-resources.py from the images in
+ * quantum/visualizer/resources/images and the elements in
+ * animation-keyframes.c, don't edit this file. Run
+ *      make <keyboard>:<keymap>:visualizer-resources
+ * after changing either of them.
+*/"""
+
+FRAMEBUFFER_ROW_BYTES = LCD_WIDTH // 8
+
+
+def element_checksum(element):
+    """Same as ELEMENT_DELTAS_CHECKSUM in animation-keyframes.c"""
+    checksum = (((element.box[0] * 131 + element.box[1]) * 131 + element.box[2]) * 131 + element.box[3]) * 4
+    checksum += (element.axis == 'Y') * 2 + (element.direction == 'POSITIVE')
+    for offset, previous_offset in element.steps:
+        checksum += (offset + 1) * (offset + 1) * (previous_offset + 7)
+    return checksum & 0xffffffff
+
+
+def render_element(element, image, offset, erase_white):
+    """The framebuffer bytes of the element's rows, with image drawn at offset, None meaning nothing at all"""
+    first_byte = element.box[0] // 8
+    row_bytes = element.box[2] // 8 - first_byte + 1
+    data = bytearray((0xff if erase_white else 0) for _ in range(row_bytes * element.height))
+
+    for y in range(element.height):
+        for x in range(element.width):
+            source_x, source_y = x, y
+            shift = offset if element.direction == 'NEGATIVE' else -offset
+            if element.axis == 'X':
+                source_x += shift
+            else:
+                source_y += shift
+
+            white = erase_white
+            if image is not None and 0 <= source_x < image.width and 0 <= source_y < image.height:
+                white = image.pixels[source_y * image.width + source_x]
+
+            screen_x = element.box[0] + x
+            bit = 0x80 >> (screen_x % 8)
+            index = y * row_bytes + screen_x // 8 - first_byte
+            data[index] = data[index] | bit if white else data[index] & ~bit
+    return data
+
+
+def encode_delta(element, before, after):
+    """XOR runs turning before into after and the area they change, see ElementDeltaStep in animation-keyframes.c"""
+    first_byte = element.box[0] // 8
+    row_bytes = element.box[2] // 8 - first_byte + 1
+
+    runs = bytearray()
+    position = 0
+    columns = []
+    rows = []
+    for y in range(element.height):
+        x = 0
+        while x < row_bytes:
+            if before[y * row_bytes + x] == after[y * row_bytes + x]:
+                x += 1
+                continue
+
+            run = bytearray()
+            while x < row_bytes and before[y * row_bytes + x] != after[y * row_bytes + x]:
+                run.append(before[y * row_bytes + x] ^ after[y * row_bytes + x])
+                columns.append(x)
+                x += 1
+            rows.append(y)
+
+            start = (element.box[1] + y) * FRAMEBUFFER_ROW_BYTES + first_byte + x - len(run)
+            while start - position > 255:
+                runs += bytes((255, 0))
+                position += 255
+            runs += bytes((start - position, len(run))) + run
+            position = start + len(run)
+
+    if not runs:
+        return bytes(), (0, 0, 0, 0)
+
+    # whole bytes, but never past the element
+    left = max((first_byte + min(columns)) * 8, element.box[0])
+    right = min((first_byte + max(columns) + 1) * 8, element.box[2] + 1)
+    return bytes(runs), (left, element.box[1] + min(rows), right - left, max(rows) - min(rows) + 1)
+
+
+def generate_deltas(elements, images, path):
+    by_name = {c_name(image.name): image for image in images}
+    # duplicate images share their deltas too
+    original_name = {c_name(image.name): c_name(original.name) for image, original in find_duplicates(images)[1]}
+
+    def stream_key(element, resource):
+        return element.name, original_name.get(resource, resource)
+
+    # keeps the output in ElementResourceMap order and every stream only once
+    pairs = []
+    for row in elements.resource_map:
+        for element, resource in zip(elements.elements, row):
+            if resource is not None and stream_key(element, resource) not in [stream_key(*pair) for pair in pairs]:
+                pairs.append((element, resource))
+
+    definitions = []
+    stream_sizes = {}
+    for element, resource in pairs:
+        image = by_name[resource]
+        frames = [render_element(element, image, offset, elements.erase_white) for offset in element.offsets]
+        blank = render_element(element, None, 0, elements.erase_white)
+
+        steps = [encode_delta(element, frames[frame], frames[frame + 1]) for frame in range(elements.total_frames)]
+        appear = encode_delta(element, blank, frames[elements.total_frames])
+
+        name = 'element_deltas_%s_%s' % (element.name.lower(), resource[len('resource_'):])
+        offsets = []
+        data = bytearray()
+        for runs, _ in steps + [appear]:
+            offsets.append(len(data))
+            data += runs
+
+        def step_initializer(index, delta):
+            runs, area = delta
+            return '{ { %3d, %2d, %3d, %2d }, %4d, %s_runs + %d }' % (area + (len(runs), name, offsets[index]))
+
+        definitions.append('''// %(element)s showing %(resource)s
+static const uint8_t %(name)s_runs[%(size)d] = {
+%(bytes)s
+};
+
+static const ElementDeltas %(name)s = {
+    .resource = &%(resource)s,
+    .steps = {
+%(steps)s
+    },
+    .appear = %(appear)s
+};
+''' % {
+            'element': element.name,
+            'resource': resource,
+            'name': name,
+            'size': max(len(data), 1),
+            'bytes': format_bytes(data) if data else '    0x00',
+            'steps': ',\n'.join('        ' + step_initializer(index, step) for index, step in enumerate(steps)),
+            'appear': step_initializer(len(steps), appear),
+        })
+        stream_sizes[stream_key(element, resource)] = (name, len(data))
+
+    rows = []
+    for row in elements.resource_map:
+        entries = ['&' + stream_sizes[stream_key(element, resource)][0] if resource else 'NULL' for element, resource in zip(elements.elements, row)]
+        rows.append('    { %s }' % ', '.join(entries))
+
+    checksums = '\n'.join('#define ELEMENT_DELTAS_CHECKSUM_%s 0x%08xu' % (element.name, element_checksum(element)) for element in elements.elements)
+
+    with open(path, 'w') as file:
+        file.write('''%(notice)s
+
+#pragma once
+
+#define ELEMENT_DELTAS_TOTAL_FRAMES %(total_frames)d
+
+// see ELEMENT_DELTAS_CHECKSUM in animation-keyframes.c
+%(checksums)s
+
+%(definitions)s
+static const ElementDeltas *const ElementDeltaMap[TOTAL_LAYERS][TOTAL_ELEMENTS] = {
+%(rows)s
+};
+''' % {
+            'notice': DELTAS_NOTICE,
+            'total_frames': elements.total_frames,
+            'checksums': checksums,
+            'definitions': '\n'.join(definitions),
+            'rows': ',\n'.join(rows),
+        })
+
+    return stream_sizes, stream_key
+
+
+def report_deltas(elements, stream_sizes, stream_key):
+    total = sum(size for _, size in stream_sizes.values())
+    print('generate-resources: %d bytes of element deltas' % total)
+
+    # worst case of a layer change, every element slides all the way out and back in
+    layers = range(len(elements.resource_map))
+    print('    delta bytes read by a full transition, from (row) to (column) layer')
+    print('    ' + ''.join('%7d' % layer for layer in layers))
+    for source in layers:
+        line = []
+        for target in layers:
+            size = 0
+            for index, element in enumerate(elements.elements):
+                old, new = elements.resource_map[source][index], elements.resource_map[target][index]
+                if new is None or old == new:
+                    continue
+                for resource in (old, new):
+                    if resource is not None:
+                        size += stream_sizes[stream_key(element, resource)][1]
+            line.append('%7d' % size)
+        print('    %d%s' % (source, ''.join(line)))
+
+
+# OUTPUT ========================================================================================================================
+
+GENERATED_NOTICE = """/**
+ * Generated by generate-resources.py from the images in images/, don't edit
+ * this file. Add or change an image and run
+ *      make <keyboard>:<keymap>:visualizer-resources
+ * instead.
+*/"""
+
+HEADER_TEMPLATE = """/* Copyright 2017 Fred Sundvik
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+%(notice)s
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef LCD_ENABLE
+/**
+ * How the data of a resource_bitmap_t is stored
+ *
+ * RESOURCE_FORMAT_RAW: 1 bit per pixel, 8 pixels per byte, most significant
+ *      bit first, row by row, the same format as resource_lcd_logo
+ * RESOURCE_FORMAT_PACKBITS: the raw format compressed with PackBits. Each
+ *      run starts with a header byte n. For n = 0..127 the next n + 1 bytes
+ *      are copied as they are, for n = 129..255 the next byte is repeated
+ *      257 - n times, n = 128 is ignored.
+ * RESOURCE_FORMAT_PAGES: the order of the LCD controller's memory. The
+ *      bitmap is cut into pages 8 pixels tall, stored one after the other.
+ *      Each page holds one byte per column, the top pixel being the least
+ *      significant bit. The width can't be larger than the LCD's.
+*/
+typedef enum {
+    RESOURCE_FORMAT_RAW,
+    RESOURCE_FORMAT_PACKBITS,
+    RESOURCE_FORMAT_PAGES,
+} resource_format_t;
+
+typedef struct {
+    resource_format_t format;
+    uint8_t           width;
+    uint8_t           height;
+    uint16_t          size; // bytes of data, not pixels
+    const uint8_t*    data;
+} resource_bitmap_t;
+
+/**
+ * A font of pre-rasterized glyphs. They sit side by side in the atlas, a
+ * RESOURCE_FORMAT_RAW bitmap as tall as the font, and the width of every
+ * glyph includes the space that follows it.
+*/
+typedef struct {
+    char    character;
+    uint8_t x;  // first column of the glyph in the atlas
+    uint8_t width;
+} resource_glyph_t;
+
+typedef struct {
+    const resource_bitmap_t* atlas;
+    const resource_glyph_t*  glyphs;  // sorted by character
+    uint8_t                  num_glyphs;
+} resource_font_t;
+
+extern const uint8_t resource_lcd_logo[];
+%(declarations)s
+#endif
+"""
+
+
+def c_name(image_name):
+    return 'resource_' + re.sub(r'[^0-9a-zA-Z]', '_', image_name)
+
+
+def format_bytes(data):
+    rows = []
+    for i in range(0, len(data), 8):
+        rows.append('    ' + ', '.join('0x%02x' % byte for byte in data[i:i + 8]))
+    return ',\n'.join(rows)
+
+
+def encode(image, page_order):
+    """Returns (format, data, comment) of the way image is stored"""
+    if page_order:
+        return 'RESOURCE_FORMAT_PAGES', image.to_pages(), ', in page order'
+
+    raw = image.to_raw()
+    compressed = packbits(raw)
+    assert unpackbits(compressed) == raw
+
+    if len(compressed) <= len(raw) * PACKBITS_MAX_RATIO:
+        return 'RESOURCE_FORMAT_PACKBITS', compressed, ', PackBits compressed (%d bytes uncompressed)' % len(raw)
+    return 'RESOURCE_FORMAT_RAW', raw, ''
+
+
+def find_duplicates(images):
+    """Returns the images with unique content and a list of (duplicate, original) pairs"""
+    unique = {}
+    aliases = []
+    for image in images:
+        key = hashlib.sha1(struct.pack('>BB', image.width, image.height) + image.to_raw()).hexdigest()
+        if key in unique:
+            aliases.append((image, unique[key]))
+        else:
+            unique[key] = image
+    return unique, aliases
+
+
+def c_char(character):
+    return "'\\%s'" % character if character in '\'\\' else "'%s'" % character
+
+
+def generate_font(font):
+    glyphs = ',\n'.join("    {%s, %d, %d}" % (c_char(character), x, width) for character, x, width in font.glyphs)
+    name = c_name(font.atlas.name)
+
+    return '''// %(file)s, %(count)d glyphs "%(characters)s", %(width)dx%(height)d
+static const uint8_t %(name)s_atlas_data[%(size)d] = {
+%(bytes)s
+};
+
+static const resource_bitmap_t %(name)s_atlas = {
+    .format = RESOURCE_FORMAT_RAW,
+    .width  = %(width)d,
+    .height = %(height)d,
+    .size   = sizeof(%(name)s_atlas_data),
+    .data   = %(name)s_atlas_data
+};
+
+static const resource_glyph_t %(name)s_glyphs[%(count)d] = {
+%(glyphs)s
+};
+
+__attribute__((weak)) const resource_font_t %(name)s = {
+    .atlas      = &%(name)s_atlas,
+    .glyphs     = %(name)s_glyphs,
+    .num_glyphs = %(count)d
+};
+''' % {
+        'file': os.path.basename(font.path),
+        'name': name,
+        'count': len(font.glyphs),
+        'characters': ''.join(character for character, _, _ in font.glyphs).replace('\\', '\\\\').replace('"', '\\"'),
+        'width': font.atlas.width,
+        'height': font.atlas.height,
+        'size': len(font.atlas.to_raw()),
+        'bytes': format_bytes(font.atlas.to_raw()),
+        'glyphs': glyphs,
+    }
+
+
+def generate(images, fonts, output_dir):
+    unique, aliases = find_duplicates(images)
+
+    declarations = []
+    for suffix in ('', '_pages'):
+        for image in unique.values():
+            declarations.append('extern const resource_bitmap_t %s%s;' % (c_name(image.name), suffix))
+        for image, original in aliases:
+            declarations.append('#define %s%s %s%s // same image as %s' % (
+                c_name(image.name), suffix, c_name(original.name), suffix, os.path.basename(original.path)))
+
+    for font in fonts:
+        declarations.append('extern const resource_font_t %s;' % c_name(font.atlas.name))
+
+    definitions = []
+    total_size = 0
+    for page_order in (False, True):
+        for image in unique.values():
+            resource_format, data, comment = encode(image, page_order)
+            if not page_order:
+                total_size += len(data)
+
+            definitions.append('''// %(file)s, %(width)dx%(height)d%(comment)s
+static const uint8_t %(name)s_data[%(size)d] = {
+%(bytes)s
+};
+
+__attribute__((weak)) const resource_bitmap_t %(name)s = {
+    .format = %(format)s,
+    .width  = %(width)d,
+    .height = %(height)d,
+    .size   = sizeof(%(name)s_data),
+    .data   = %(name)s_data
+};
+''' % {
+                'file': os.path.basename(image.path),
+                'name': c_name(image.name) + ('_pages' if page_order else ''),
+                'width': image.width,
+                'height': image.height,
+                'comment': comment,
+                'size': len(data),
+                'bytes': format_bytes(data),
+                'format': resource_format,
+            })
+
+    definitions.extend(generate_font(font) for font in fonts)
+
+    with open(os.path.join(output_dir, 'resources.h'), 'w') as file:
+        file.write(HEADER_TEMPLATE % {'notice': GENERATED_NOTICE, 'declarations': '\n'.join(declarations)})
+
+    with open(os.path.join(output_dir, 'resources.c'), 'w') as file:
+        file.write('%s\n\n#include "resources.h"\n\n#ifdef LCD_ENABLE\n%s#endif\n' % (GENERATED_NOTICE, '\n'.join(definitions)))
+
+    return len(unique), len(aliases), total_size
+
+
+def read_image(path):
+    with open(path, 'rb') as file:
+        data = file.read()
+    name = os.path.splitext(os.path.basename(path))[0]
+    try:
+        reader = read_png if data.startswith(PNG_SIGNATURE) else read_pbm
+        return Image(name, path, *reader(data))
+    except (ResourceError, ValueError, zlib.error) as error:
+        raise ResourceError('%s: %s' % (path, error))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('--elements', help='animation-keyframes.c to check the image sizes against')
+    parser.add_argument('--deltas', help='element-deltas.h to write, needs --elements')
+    parser.add_argument('--fonts', help='directory of glyph sheets to turn into fonts')
+    parser.add_argument('--text', help='source file whose layer_text strings decide the glyphs kept, needs --fonts')
+    parser.add_argument('image_dir')
+    parser.add_argument('output_dir')
+    arguments = parser.parse_args()
+
+    try:
+        paths = sorted(
+            os.path.join(arguments.image_dir, file) for file in os.listdir(arguments.image_dir)
+            if file.lower().endswith(('.pbm', '.png'))
+        )
+        images = [read_image(path) for path in paths]
+
+        names = {}
+        for image in images:
+            # every image also gets a page ordered variant, which lcd-framebuffer.c
+            # transposes into rows no wider than the LCD
+            if image.width > LCD_WIDTH or image.height > 255:
+                raise ResourceError('%s: images can be at most %dx255 pixels, page ordered ones can\'t be wider than the LCD' % (
+                    image.path, LCD_WIDTH))
+            if c_name(image.name) in names:
+                raise ResourceError('%s and %s both become %s' % (names[c_name(image.name)], image.path, c_name(image.name)))
+            names[c_name(image.name)] = image.path
+
+        if arguments.deltas and not arguments.elements:
+            raise ResourceError('--deltas needs --elements')
+        if arguments.text and not arguments.fonts:
+            raise ResourceError('--text needs --fonts')
+
+        fonts = []
+        if arguments.fonts:
+            fonts = [read_font(os.path.join(arguments.fonts, file)) for file in sorted(os.listdir(arguments.fonts))
+                     if file.lower().endswith(('.pbm', '.png'))]
+        if arguments.text:
+            characters = read_text_characters(arguments.text)
+            for font in fonts:
+                missing = characters - set(character for character, _, _ in font.glyphs)
+                if missing:
+                    raise ResourceError('%s: no glyphs for %s used in %s' % (font.path, ''.join(sorted(missing)), arguments.text))
+            fonts = [font.keep(characters) for font in fonts]
+        for font in fonts:
+            if font.atlas.width > 255:
+                raise ResourceError('%s: the atlas can be at most 255 pixels wide' % font.path)
+
+        elements = None
+        if arguments.elements:
+            elements = read_elements(arguments.elements)
+            by_name = {c_name(image.name): image for image in images}
+            for resource, (element, width, height) in sorted(elements.sizes().items()):
+                image = by_name.get(resource)
+                if image is None:
+                    raise ResourceError('%s is used by %s, but there is no image for it' % (resource, element))
+                if (image.width, image.height) != (width, height):
+                    raise ResourceError('%s: %s is %dx%d, but the %s element is %dx%d' % (
+                        image.path, resource, image.width, image.height, element, width, height))
+
+        unique, aliases, total_size = generate(images, fonts, arguments.output_dir)
+
+        stream_sizes = None
+        if arguments.deltas:
+            stream_sizes, stream_key = generate_deltas(elements, images, arguments.deltas)
+    except (ResourceError, OSError) as error:
+        print('generate-resources: %s' % error, file=sys.stderr)
+        return 1
+
+    print('generate-resources: %d images, %d of them duplicates, %d bytes of row ordered data' % (unique + aliases, aliases, total_size))
+    for font in fonts:
+        print('generate-resources: %s, %d glyphs, %d bytes of atlas and %d of glyph table' % (
+            os.path.basename(font.path), len(font.glyphs), len(font.atlas.to_raw()), 3 * len(font.glyphs)))
+    if stream_sizes is not None:
+        report_deltas(elements, stream_sizes, stream_key)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
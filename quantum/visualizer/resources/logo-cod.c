@@ -1,64 +0,0 @@
-
-/*******************************************************************************
-* image
-* filename: unsaved
-* name: logo-cod
-*
-* preset name: Monochrome
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Edge 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
-/*
- typedef struct {
-     const uint8_t *data;
-     uint16_t width;
-     uint16_t height;
-     uint8_t dataSize;
-     } tImage;
-*/
-#include "resources.h"
-
-
-
-__attribute__((weak)) const uint8_t resource_logo_cod[128] = {
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0x87, 0xf8, 0xff, 0xc7, 
-    0x7b, 0xf7, 0x73, 0xbb, 
-    0x7d, 0xef, 0x6d, 0xbb, 
-    0x7e, 0xdf, 0x5e, 0xbb, 
-    0x7e, 0x3f, 0x1f, 0x3b, 
-    0x7f, 0x3a, 0x3f, 0xbb, 
-    0x77, 0xf1, 0x7b, 0xfb, 
-    0x73, 0xe3, 0xf1, 0xfb, 
-    0x71, 0xeb, 0xec, 0xfb, 
-    0x76, 0xdb, 0xde, 0xfb, 
-    0x76, 0x3b, 0xbf, 0x7b, 
-    0x87, 0x7c, 0x3f, 0x87, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff
-};
@@ -1,64 +0,0 @@
-
-/*******************************************************************************
-* image
-* filename: unsaved
-* name: logo-mac
-*
-* preset name: Monochrome
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Edge 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
-/*
- typedef struct {
-     const uint8_t *data;
-     uint16_t width;
-     uint16_t height;
-     uint8_t dataSize;
-     } tImage;
-*/
-#include "resources.h"
-
-
-
-__attribute__((weak)) const uint8_t resource_logo_mac[128] = {
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xf7, 0xff, 
-    0xff, 0xff, 0xe7, 0xff, 
-    0xff, 0xff, 0xcf, 0xff, 
-    0xff, 0xff, 0x8f, 0xff, 
-    0xff, 0xff, 0x9f, 0xff, 
-    0xff, 0xff, 0x3f, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0x83, 0xc0, 0xff, 
-    0xfe, 0x00, 0x00, 0x7f, 
-    0xfc, 0x00, 0x00, 0x3f, 
-    0xf8, 0x00, 0x00, 0x7f, 
-    0xf0, 0x00, 0x00, 0xff, 
-    0xf0, 0x00, 0x01, 0xff, 
-    0xf0, 0x00, 0x01, 0xff, 
-    0xf0, 0x00, 0x01, 0xff, 
-    0xf0, 0x00, 0x01, 0xff, 
-    0xf0, 0x00, 0x00, 0xff, 
-    0xf0, 0x00, 0x00, 0xff, 
-    0xf0, 0x00, 0x00, 0x7f, 
-    0xf8, 0x00, 0x00, 0x3f, 
-    0xf8, 0x00, 0x00, 0x1f, 
-    0xf8, 0x00, 0x00, 0x1f, 
-    0xfc, 0x00, 0x00, 0x1f, 
-    0xfe, 0x00, 0x00, 0x1f, 
-    0xfe, 0x00, 0x00, 0x3f, 
-    0xff, 0x00, 0x00, 0x7f, 
-    0xff, 0x80, 0x00, 0xff, 
-    0xff, 0xc1, 0xe1, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff
-};
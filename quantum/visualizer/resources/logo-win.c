@@ -1,64 +0,0 @@
-
-/*******************************************************************************
-* image
-* filename: unsaved
-* name: logo-win
-*
-* preset name: Monochrome
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Edge 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
-/*
- typedef struct {
-     const uint8_t *data;
-     uint16_t width;
-     uint16_t height;
-     uint8_t dataSize;
-     } tImage;
-*/
-#include "resources.h"
-
-
-
-__attribute__((weak)) const uint8_t resource_logo_win[128] = {
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xc0, 0x01, 0x80, 0x03, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff
-};
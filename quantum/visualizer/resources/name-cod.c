@@ -1,48 +0,0 @@
-
-/*******************************************************************************
-* image
-* filename: unsaved
-* name: name-cod
-*
-* preset name: Monochrome
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Edge 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
-/*
- typedef struct {
-     const uint8_t *data;
-     uint16_t width;
-     uint16_t height;
-     uint8_t dataSize;
-     } tImage;
-*/
-#include "resources.h"
-
-
-
-__attribute__((weak)) const uint8_t resource_name_cod[128] = {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0x18, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0x18, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0x08, 0xc3, 0xc5, 0xc3, 0x91, 0x93, 0xff, 0xff, 
-    0x28, 0x81, 0x81, 0x81, 0x81, 0x81, 0xff, 0xff, 
-    0x24, 0x9d, 0x99, 0x9d, 0x9c, 0x99, 0xff, 0xff, 
-    0x34, 0x9d, 0x9d, 0x81, 0x9d, 0x9d, 0xff, 0xff, 
-    0x3c, 0x9d, 0x9d, 0x81, 0x9f, 0x9d, 0xff, 0xff, 
-    0x3c, 0x9d, 0x99, 0x9f, 0x9f, 0x9d, 0xff, 0xff, 
-    0x3c, 0x81, 0x81, 0x81, 0x9f, 0x9d, 0xff, 0xff, 
-    0x3c, 0xc3, 0xc5, 0xc3, 0x9f, 0x9d, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
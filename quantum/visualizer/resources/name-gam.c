@@ -1,48 +0,0 @@
-
-/*******************************************************************************
-* image
-* filename: unsaved
-* name: gaming
-*
-* preset name: Monochrome
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Edge 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
-/*
- typedef struct {
-     const uint8_t *data;
-     uint16_t width;
-     uint16_t height;
-     uint8_t dataSize;
-     } tImage;
-*/
-#include "resources.h"
-
-
-
-__attribute__((weak)) const uint8_t resource_name_gam[128] = {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xc3, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 
-    0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0x9d, 0xc3, 0x89, 0x87, 0x93, 0xc5, 0xff, 0xff, 
-    0x9f, 0x81, 0x80, 0xc7, 0x81, 0x81, 0xff, 0xff, 
-    0x91, 0xfd, 0xb4, 0xf7, 0x99, 0x99, 0xff, 0xff, 
-    0x90, 0xc1, 0xb4, 0xf7, 0x9d, 0x9d, 0xff, 0xff, 
-    0x9d, 0x81, 0xb4, 0xf7, 0x9d, 0x9d, 0xff, 0xff, 
-    0x9d, 0x9d, 0xb4, 0xf7, 0x9d, 0x9d, 0xff, 0xff, 
-    0x81, 0x81, 0xb4, 0x81, 0x9d, 0x99, 0xff, 0xff, 
-    0xc3, 0xc5, 0xb4, 0x80, 0x9d, 0xc1, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff
-};
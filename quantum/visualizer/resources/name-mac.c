@@ -1,48 +0,0 @@
-
-/*******************************************************************************
-* image
-* filename: unsaved
-* name: macOs
-*
-* preset name: Monochrome
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Edge 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
-/*
- typedef struct {
-     const uint8_t *data;
-     uint16_t width;
-     uint16_t height;
-     uint8_t dataSize;
-     } tImage;
-*/
-#include "resources.h"
-
-
-
-__attribute__((weak)) const uint8_t resource_name_mac[128] = {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 
-    0x13, 0x87, 0x87, 0x3b, 0x87, 0xff, 0xff, 0xff, 
-    0x01, 0x03, 0x03, 0x3b, 0x03, 0xff, 0xff, 0xff, 
-    0x69, 0xfb, 0x3b, 0x3b, 0x3f, 0xff, 0xff, 0xff, 
-    0x69, 0x83, 0x3f, 0x3b, 0x8f, 0xff, 0xff, 0xff, 
-    0x69, 0x03, 0x3f, 0x3b, 0xc3, 0xff, 0xff, 0xff, 
-    0x69, 0x3b, 0x3b, 0x3b, 0xfb, 0xff, 0xff, 0xff, 
-    0x69, 0x03, 0x03, 0x03, 0x13, 0xff, 0xff, 0xff, 
-    0x69, 0x8b, 0x87, 0x87, 0x87, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
@@ -0,0 +1,662 @@
+/**
+ * Generated by generate-resources.py from the images in images/, don't edit
+ * this file. Add or change an image and run
+ *      make <keyboard>:<keymap>:visualizer-resources
+ * instead.
+*/
+
+#include "resources.h"
+
+#ifdef LCD_ENABLE
+// logo-cod.pbm, 32x32, PackBits compressed (128 bytes uncompressed)
+static const uint8_t resource_logo_cod_data[53] = {
+    0xd9, 0xff, 0x2f, 0x87, 0xf8, 0xff, 0xc7, 0x7b,
+    0xf7, 0x73, 0xbb, 0x7d, 0xef, 0x6d, 0xbb, 0x7e,
+    0xdf, 0x5e, 0xbb, 0x7e, 0x3f, 0x1f, 0x3b, 0x7f,
+    0x3a, 0x3f, 0xbb, 0x77, 0xf1, 0x7b, 0xfb, 0x73,
+    0xe3, 0xf1, 0xfb, 0x71, 0xeb, 0xec, 0xfb, 0x76,
+    0xdb, 0xde, 0xfb, 0x76, 0x3b, 0xbf, 0x7b, 0x87,
+    0x7c, 0x3f, 0x87, 0xd9, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_logo_cod = {
+    .format = RESOURCE_FORMAT_PACKBITS,
+    .width  = 32,
+    .height = 32,
+    .size   = sizeof(resource_logo_cod_data),
+    .data   = resource_logo_cod_data
+};
+
+// logo-gam.pbm, 32x32
+static const uint8_t resource_logo_gam_data[128] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc0, 0x01, 0x80, 0x03, 0xc0, 0x01, 0x80, 0x03,
+    0xc0, 0x01, 0x80, 0x03, 0xc0, 0x01, 0x80, 0x03,
+    0xc0, 0x01, 0x80, 0x03, 0xc0, 0x01, 0x80, 0x03,
+    0xc0, 0x01, 0x80, 0x03, 0xc0, 0x01, 0x80, 0x03,
+    0xc0, 0x01, 0x80, 0x03, 0xc0, 0x01, 0x80, 0x03,
+    0xc0, 0x01, 0x80, 0x03, 0xc0, 0x01, 0x80, 0x03,
+    0xc0, 0x01, 0x80, 0x03, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0x80, 0x03,
+    0xc0, 0x01, 0x80, 0x03, 0xc0, 0x01, 0x80, 0x03,
+    0xc0, 0x01, 0x80, 0x03, 0xc0, 0x01, 0x80, 0x03,
+    0xc0, 0x01, 0x80, 0x03, 0xc0, 0x01, 0x80, 0x03,
+    0xc0, 0x01, 0x80, 0x03, 0xc0, 0x01, 0x80, 0x03,
+    0xc0, 0x01, 0x80, 0x03, 0xc0, 0x01, 0x80, 0x03,
+    0xc0, 0x01, 0x80, 0x03, 0xc0, 0x01, 0x80, 0x03,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_logo_gam = {
+    .format = RESOURCE_FORMAT_RAW,
+    .width  = 32,
+    .height = 32,
+    .size   = sizeof(resource_logo_gam_data),
+    .data   = resource_logo_gam_data
+};
+
+// logo-mac.pbm, 32x32
+static const uint8_t resource_logo_mac_data[128] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xe7, 0xff,
+    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x8f, 0xff,
+    0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xc0, 0xff,
+    0xfe, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x3f,
+    0xf8, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x00, 0xff,
+    0xf0, 0x00, 0x01, 0xff, 0xf0, 0x00, 0x01, 0xff,
+    0xf0, 0x00, 0x01, 0xff, 0xf0, 0x00, 0x01, 0xff,
+    0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff,
+    0xf0, 0x00, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x3f,
+    0xf8, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x1f,
+    0xfc, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x1f,
+    0xfe, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x7f,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0xc1, 0xe1, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_logo_mac = {
+    .format = RESOURCE_FORMAT_RAW,
+    .width  = 32,
+    .height = 32,
+    .size   = sizeof(resource_logo_mac_data),
+    .data   = resource_logo_mac_data
+};
+
+// mode-cod.pbm, 64x16, PackBits compressed (128 bytes uncompressed)
+static const uint8_t resource_mode_cod_data[79] = {
+    0xf1, 0xff, 0x03, 0x26, 0xff, 0xff, 0xf0, 0xfd,
+    0xff, 0x03, 0x26, 0xff, 0xff, 0xe1, 0xfd, 0xff,
+    0x08, 0x24, 0xc3, 0x91, 0x80, 0xc3, 0x91, 0xc3,
+    0xff, 0xa4, 0xfb, 0x81, 0x2f, 0xff, 0xac, 0xfd,
+    0x9c, 0xe7, 0xfd, 0x9c, 0x9d, 0xff, 0xa8, 0xc1,
+    0x9d, 0xe7, 0xc1, 0x9d, 0x81, 0xff, 0x89, 0x81,
+    0x9f, 0xe7, 0x81, 0x9f, 0x81, 0xff, 0x89, 0x9d,
+    0x9f, 0xe7, 0x9d, 0x9f, 0x9f, 0xff, 0x99, 0x81,
+    0x9f, 0xe7, 0x81, 0x9f, 0x81, 0xff, 0x99, 0xc5,
+    0x9f, 0xe7, 0xc5, 0x9f, 0xc3, 0xe0, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_mode_cod = {
+    .format = RESOURCE_FORMAT_PACKBITS,
+    .width  = 64,
+    .height = 16,
+    .size   = sizeof(resource_mode_cod_data),
+    .data   = resource_mode_cod_data
+};
+
+// mode-fn.pbm, 64x16, PackBits compressed (128 bytes uncompressed)
+static const uint8_t resource_mode_fn_data[50] = {
+    0xf1, 0xff, 0x00, 0x03, 0xfa, 0xff, 0x00, 0x03,
+    0xfa, 0xff, 0x01, 0x3f, 0x27, 0xfb, 0xff, 0x01,
+    0x3f, 0x03, 0xfb, 0xff, 0x01, 0x03, 0x33, 0xfb,
+    0xff, 0x01, 0x03, 0x3b, 0xfb, 0xff, 0x01, 0x3f,
+    0x3b, 0xfb, 0xff, 0x01, 0x3f, 0x3b, 0xfb, 0xff,
+    0x01, 0x3f, 0x3b, 0xfb, 0xff, 0x01, 0x3f, 0x3b,
+    0xdb, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_mode_fn = {
+    .format = RESOURCE_FORMAT_PACKBITS,
+    .width  = 64,
+    .height = 16,
+    .size   = sizeof(resource_mode_fn_data),
+    .data   = resource_mode_fn_data
+};
+
+// mode-mode.pbm, 64x16, PackBits compressed (128 bytes uncompressed)
+static const uint8_t resource_mode_mode_data[64] = {
+    0xef, 0xff, 0x00, 0xfb, 0xfa, 0xff, 0x00, 0xfb,
+    0xfc, 0xff, 0x03, 0x13, 0x87, 0x8b, 0x87, 0xfd,
+    0xff, 0x00, 0x01, 0xfe, 0x03, 0xfd, 0xff, 0x03,
+    0x69, 0x3b, 0x33, 0x3b, 0xfd, 0xff, 0x03, 0x69,
+    0x3b, 0x3b, 0x03, 0xfd, 0xff, 0x03, 0x69, 0x3b,
+    0x3b, 0x03, 0xfd, 0xff, 0x03, 0x69, 0x3b, 0x33,
+    0x3f, 0xfd, 0xff, 0x00, 0x69, 0xfe, 0x03, 0xfd,
+    0xff, 0x03, 0x69, 0x87, 0x8b, 0x87, 0xdd, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_mode_mode = {
+    .format = RESOURCE_FORMAT_PACKBITS,
+    .width  = 64,
+    .height = 16,
+    .size   = sizeof(resource_mode_mode_data),
+    .data   = resource_mode_mode_data
+};
+
+// name-cod.pbm, 64x16, PackBits compressed (128 bytes uncompressed)
+static const uint8_t resource_name_cod_data[77] = {
+    0xe9, 0xff, 0x02, 0x18, 0xff, 0xfd, 0xfc, 0xff,
+    0x02, 0x18, 0xff, 0xfd, 0xfc, 0xff, 0x08, 0x08,
+    0xc3, 0xc5, 0xc3, 0x91, 0x93, 0xff, 0xff, 0x28,
+    0xfc, 0x81, 0xff, 0xff, 0x20, 0x24, 0x9d, 0x99,
+    0x9d, 0x9c, 0x99, 0xff, 0xff, 0x34, 0x9d, 0x9d,
+    0x81, 0x9d, 0x9d, 0xff, 0xff, 0x3c, 0x9d, 0x9d,
+    0x81, 0x9f, 0x9d, 0xff, 0xff, 0x3c, 0x9d, 0x99,
+    0x9f, 0x9f, 0x9d, 0xff, 0xff, 0x3c, 0xfe, 0x81,
+    0x09, 0x9f, 0x9d, 0xff, 0xff, 0x3c, 0xc3, 0xc5,
+    0xc3, 0x9f, 0x9d, 0xe7, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_name_cod = {
+    .format = RESOURCE_FORMAT_PACKBITS,
+    .width  = 64,
+    .height = 16,
+    .size   = sizeof(resource_name_cod_data),
+    .data   = resource_name_cod_data
+};
+
+// name-gam.pbm, 64x16, PackBits compressed (128 bytes uncompressed)
+static const uint8_t resource_name_gam_data[90] = {
+    0xe9, 0xff, 0x03, 0xc3, 0xff, 0xff, 0xe7, 0xfd,
+    0xff, 0x00, 0x81, 0xfa, 0xff, 0x3d, 0x9d, 0xc3,
+    0x89, 0x87, 0x93, 0xc5, 0xff, 0xff, 0x9f, 0x81,
+    0x80, 0xc7, 0x81, 0x81, 0xff, 0xff, 0x91, 0xfd,
+    0xb4, 0xf7, 0x99, 0x99, 0xff, 0xff, 0x90, 0xc1,
+    0xb4, 0xf7, 0x9d, 0x9d, 0xff, 0xff, 0x9d, 0x81,
+    0xb4, 0xf7, 0x9d, 0x9d, 0xff, 0xff, 0x9d, 0x9d,
+    0xb4, 0xf7, 0x9d, 0x9d, 0xff, 0xff, 0x81, 0x81,
+    0xb4, 0x81, 0x9d, 0x99, 0xff, 0xff, 0xc3, 0xc5,
+    0xb4, 0x80, 0x9d, 0xc1, 0xfa, 0xff, 0x00, 0xfd,
+    0xfa, 0xff, 0x00, 0xb1, 0xfa, 0xff, 0x00, 0xc3,
+    0xff, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_name_gam = {
+    .format = RESOURCE_FORMAT_PACKBITS,
+    .width  = 64,
+    .height = 16,
+    .size   = sizeof(resource_name_gam_data),
+    .data   = resource_name_gam_data
+};
+
+// name-mac.pbm, 64x16, PackBits compressed (128 bytes uncompressed)
+static const uint8_t resource_name_mac_data[73] = {
+    0xe6, 0xff, 0x00, 0x87, 0xfa, 0xff, 0x00, 0x03,
+    0xfd, 0xff, 0x04, 0x13, 0x87, 0x87, 0x3b, 0x87,
+    0xfe, 0xff, 0x04, 0x01, 0x03, 0x03, 0x3b, 0x03,
+    0xfe, 0xff, 0x04, 0x69, 0xfb, 0x3b, 0x3b, 0x3f,
+    0xfe, 0xff, 0x04, 0x69, 0x83, 0x3f, 0x3b, 0x8f,
+    0xfe, 0xff, 0x04, 0x69, 0x03, 0x3f, 0x3b, 0xc3,
+    0xfe, 0xff, 0x00, 0x69, 0xfe, 0x3b, 0x00, 0xfb,
+    0xfe, 0xff, 0x00, 0x69, 0xfe, 0x03, 0x00, 0x13,
+    0xfe, 0xff, 0x01, 0x69, 0x8b, 0xfe, 0x87, 0xe6,
+    0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_name_mac = {
+    .format = RESOURCE_FORMAT_PACKBITS,
+    .width  = 64,
+    .height = 16,
+    .size   = sizeof(resource_name_mac_data),
+    .data   = resource_name_mac_data
+};
+
+// name-win.pbm, 64x16, PackBits compressed (128 bytes uncompressed)
+static const uint8_t resource_name_win_data[82] = {
+    0xe9, 0xff, 0x03, 0x26, 0xe7, 0xff, 0xfd, 0xfd,
+    0xff, 0x03, 0x26, 0xff, 0xff, 0xfd, 0xfd, 0xff,
+    0x09, 0x24, 0x87, 0x93, 0xc5, 0xc3, 0x26, 0xc3,
+    0xff, 0xa4, 0xc7, 0xfe, 0x81, 0x0c, 0x26, 0x81,
+    0xff, 0xac, 0xf7, 0x99, 0x99, 0x9d, 0xa4, 0x9f,
+    0xff, 0xa8, 0xf7, 0xfe, 0x9d, 0x04, 0xa4, 0xc7,
+    0xff, 0x89, 0xf7, 0xfe, 0x9d, 0x19, 0xa9, 0xe1,
+    0xff, 0x89, 0xf7, 0x9d, 0x99, 0x9d, 0x89, 0xfd,
+    0xff, 0x99, 0x81, 0x9d, 0x81, 0x81, 0x99, 0x89,
+    0xff, 0x99, 0x80, 0x9d, 0xc5, 0xc3, 0x99, 0xc3,
+    0xe8, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_name_win = {
+    .format = RESOURCE_FORMAT_PACKBITS,
+    .width  = 64,
+    .height = 16,
+    .size   = sizeof(resource_name_win_data),
+    .data   = resource_name_win_data
+};
+
+// symbol-controller.pbm, 32x32, PackBits compressed (128 bytes uncompressed)
+static const uint8_t resource_symbol_controller_data[83] = {
+    0xeb, 0xff, 0x00, 0xe3, 0xfe, 0xff, 0x04, 0xdd,
+    0x7f, 0xff, 0xff, 0xbe, 0xfe, 0xff, 0x00, 0xbf,
+    0xfe, 0xff, 0x3d, 0xbf, 0xff, 0xff, 0xef, 0xbd,
+    0xff, 0xff, 0x83, 0xb0, 0x7f, 0xff, 0x00, 0x00,
+    0x3f, 0xfe, 0x00, 0x00, 0x1f, 0xfe, 0x30, 0x01,
+    0x1f, 0xfe, 0x31, 0x12, 0x9f, 0xfc, 0x04, 0x01,
+    0x0f, 0xfc, 0x0e, 0x0c, 0x0f, 0xfc, 0x04, 0x0c,
+    0x0f, 0xf8, 0x00, 0x00, 0x07, 0xf8, 0x00, 0x00,
+    0x07, 0xf8, 0x07, 0xf8, 0x07, 0xf8, 0x0f, 0xfc,
+    0x07, 0xf8, 0x1f, 0xfe, 0x07, 0xfc, 0x3f, 0xff,
+    0x0f, 0xe5, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_symbol_controller = {
+    .format = RESOURCE_FORMAT_PACKBITS,
+    .width  = 32,
+    .height = 32,
+    .size   = sizeof(resource_symbol_controller_data),
+    .data   = resource_symbol_controller_data
+};
+
+// symbol-keyboard.pbm, 32x32, PackBits compressed (128 bytes uncompressed)
+static const uint8_t resource_symbol_keyboard_data[82] = {
+    0xeb, 0xff, 0x00, 0x87, 0xfe, 0xff, 0x03, 0x7f,
+    0xff, 0xff, 0xfe, 0xfe, 0xff, 0x00, 0xfe, 0xfe,
+    0xff, 0x00, 0xfe, 0xfd, 0xff, 0x00, 0x7f, 0xfe,
+    0xff, 0x35, 0x7f, 0xff, 0xfc, 0x00, 0x00, 0x0f,
+    0xf8, 0x00, 0x00, 0x07, 0xf9, 0xb6, 0xdb, 0x67,
+    0xf9, 0xb6, 0xdb, 0x67, 0xf8, 0x00, 0x00, 0x07,
+    0xf9, 0xb6, 0xdb, 0x67, 0xf9, 0xb6, 0xdb, 0x67,
+    0xf8, 0x00, 0x00, 0x07, 0xf9, 0xb6, 0xdb, 0x67,
+    0xf9, 0xb6, 0xdb, 0x67, 0xf8, 0x00, 0x00, 0x07,
+    0xf8, 0x07, 0xf8, 0x07, 0xfc, 0x00, 0x00, 0x0f,
+    0xe5, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_symbol_keyboard = {
+    .format = RESOURCE_FORMAT_PACKBITS,
+    .width  = 32,
+    .height = 32,
+    .size   = sizeof(resource_symbol_keyboard_data),
+    .data   = resource_symbol_keyboard_data
+};
+
+// logo-cod.pbm, 32x32, in page order
+static const uint8_t resource_logo_cod_pages_data[128] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x07, 0xfb, 0xfb, 0xfb, 0xfb, 0xf7, 0xef, 0x9f,
+    0x3f, 0x3f, 0xdf, 0xef, 0xf7, 0x7b, 0xfb, 0x7b,
+    0x07, 0x3f, 0x9f, 0xef, 0xf7, 0xf7, 0xef, 0xdf,
+    0xbf, 0x07, 0xfb, 0xfb, 0xfb, 0x07, 0xff, 0xff,
+    0xe0, 0xdf, 0xdf, 0xdf, 0xc0, 0xf9, 0xfb, 0xe7,
+    0xcf, 0xef, 0xf7, 0xf9, 0xfc, 0xe0, 0xde, 0xdf,
+    0xde, 0xcf, 0xf7, 0xfb, 0xfd, 0xfc, 0xf9, 0xf3,
+    0xef, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_logo_cod_pages = {
+    .format = RESOURCE_FORMAT_PAGES,
+    .width  = 32,
+    .height = 32,
+    .size   = sizeof(resource_logo_cod_pages_data),
+    .data   = resource_logo_cod_pages_data
+};
+
+// logo-gam.pbm, 32x32, in page order
+static const uint8_t resource_logo_gam_pages_data[128] = {
+    0xff, 0xff, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xff,
+    0xff, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
+    0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0xff,
+    0xff, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff,
+    0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff,
+    0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_logo_gam_pages = {
+    .format = RESOURCE_FORMAT_PAGES,
+    .width  = 32,
+    .height = 32,
+    .size   = sizeof(resource_logo_gam_pages_data),
+    .data   = resource_logo_gam_pages_data
+};
+
+// logo-mac.pbm, 32x32, in page order
+static const uint8_t resource_logo_mac_pages_data[128] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x7f, 0x1f, 0x8f, 0xc7, 0xf3, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x1f, 0x0f, 0x07, 0x03,
+    0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03,
+    0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0xc1,
+    0xe3, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x0f, 0x1f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8,
+    0xf0, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0,
+    0xe0, 0xe0, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0,
+    0xf0, 0xf8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_logo_mac_pages = {
+    .format = RESOURCE_FORMAT_PAGES,
+    .width  = 32,
+    .height = 32,
+    .size   = sizeof(resource_logo_mac_pages_data),
+    .data   = resource_logo_mac_pages_data
+};
+
+// mode-cod.pbm, 64x16, in page order
+static const uint8_t resource_mode_cod_pages_data[128] = {
+    0xe3, 0x03, 0xff, 0x03, 0xc3, 0x7f, 0x0f, 0x03,
+    0xff, 0xdf, 0x4f, 0x4f, 0x4f, 0x4f, 0x1f, 0xff,
+    0xff, 0x0f, 0x0f, 0xdf, 0xcf, 0xcf, 0x0f, 0xbf,
+    0xff, 0xcf, 0xcf, 0x07, 0x03, 0xc3, 0xc3, 0xeb,
+    0xff, 0xdf, 0x4f, 0x4f, 0x4f, 0x4f, 0x1f, 0xff,
+    0xff, 0x0f, 0x0f, 0xdf, 0xcf, 0xcf, 0x0f, 0xbf,
+    0xff, 0x1f, 0x0f, 0x4f, 0x4f, 0x4f, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xf0, 0xfc, 0xff, 0xf0, 0xf0, 0xff,
+    0xff, 0xf8, 0xf0, 0xf2, 0xf2, 0xfa, 0xf0, 0xff,
+    0xff, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xf0, 0xf2, 0xf2, 0xfa, 0xf0, 0xff,
+    0xff, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xf0, 0xf2, 0xf2, 0xf2, 0xfa, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_mode_cod_pages = {
+    .format = RESOURCE_FORMAT_PAGES,
+    .width  = 64,
+    .height = 16,
+    .size   = sizeof(resource_mode_cod_pages_data),
+    .data   = resource_mode_cod_pages_data
+};
+
+// mode-fn.pbm, 64x16, in page order
+static const uint8_t resource_mode_fn_pages_data[128] = {
+    0x03, 0x03, 0x33, 0x33, 0x33, 0x33, 0xff, 0xff,
+    0x0f, 0x0f, 0xdf, 0xcf, 0x8f, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xf0, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_mode_fn_pages = {
+    .format = RESOURCE_FORMAT_PAGES,
+    .width  = 64,
+    .height = 16,
+    .size   = sizeof(resource_mode_fn_pages_data),
+    .data   = resource_mode_fn_pages_data
+};
+
+// mode-mode.pbm, 64x16, in page order
+static const uint8_t resource_mode_mode_pages_data[128] = {
+    0x0f, 0xcf, 0xcf, 0x1f, 0xcf, 0x0f, 0x1f, 0xff,
+    0x1f, 0x0f, 0xcf, 0xcf, 0xcf, 0x1f, 0xff, 0xff,
+    0x1f, 0x0f, 0xcf, 0xcf, 0x9f, 0x03, 0xff, 0xff,
+    0x1f, 0x0f, 0x4f, 0x4f, 0x4f, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xf0, 0xff,
+    0xf8, 0xf0, 0xf3, 0xf3, 0xf3, 0xf8, 0xff, 0xff,
+    0xf8, 0xf0, 0xf3, 0xf3, 0xf9, 0xf0, 0xff, 0xff,
+    0xf8, 0xf0, 0xf2, 0xf2, 0xf2, 0xfa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_mode_mode_pages = {
+    .format = RESOURCE_FORMAT_PAGES,
+    .width  = 64,
+    .height = 16,
+    .size   = sizeof(resource_mode_mode_pages_data),
+    .data   = resource_mode_mode_pages_data
+};
+
+// name-cod.pbm, 64x16, in page order
+static const uint8_t resource_name_cod_pages_data[128] = {
+    0x07, 0x07, 0xc7, 0x1f, 0x7f, 0x87, 0x07, 0x07,
+    0xff, 0x3f, 0x1f, 0x9f, 0x9f, 0x9f, 0x3f, 0xff,
+    0xff, 0x3f, 0x1f, 0x9f, 0x9f, 0x3f, 0x07, 0xff,
+    0xff, 0x3f, 0x1f, 0x9f, 0x9f, 0x9f, 0x3f, 0xff,
+    0xff, 0x1f, 0x1f, 0xbf, 0x9f, 0x9f, 0x1f, 0x7f,
+    0xff, 0x1f, 0x1f, 0xbf, 0x9f, 0x1f, 0x3f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0xe0, 0xff, 0xff, 0xfe, 0xff, 0xe0, 0xe0,
+    0xff, 0xf0, 0xe0, 0xe7, 0xe7, 0xe7, 0xf0, 0xff,
+    0xff, 0xf0, 0xe0, 0xe7, 0xe7, 0xf3, 0xe0, 0xff,
+    0xff, 0xf0, 0xe0, 0xe4, 0xe4, 0xe4, 0xf4, 0xff,
+    0xff, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xfe, 0xff,
+    0xff, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xe0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_name_cod_pages = {
+    .format = RESOURCE_FORMAT_PAGES,
+    .width  = 64,
+    .height = 16,
+    .size   = sizeof(resource_name_cod_pages_data),
+    .data   = resource_name_cod_pages_data
+};
+
+// name-gam.pbm, 64x16, in page order
+static const uint8_t resource_name_gam_pages_data[128] = {
+    0xff, 0x0f, 0x07, 0xe7, 0x67, 0x67, 0x4f, 0xff,
+    0xff, 0xbf, 0x9f, 0x9f, 0x9f, 0x9f, 0x3f, 0xff,
+    0xff, 0x1f, 0x9f, 0x9f, 0x3f, 0x9f, 0x1f, 0x3f,
+    0xff, 0xdf, 0x9f, 0x97, 0x17, 0xff, 0xff, 0xff,
+    0xff, 0x1f, 0x1f, 0xbf, 0x9f, 0x1f, 0x3f, 0xff,
+    0xff, 0x3f, 0x1f, 0x9f, 0x9f, 0x3f, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xe0, 0xe7, 0xe6, 0xe6, 0xf0, 0xfe,
+    0xff, 0xf1, 0xe0, 0xe4, 0xe4, 0xf4, 0xe0, 0xff,
+    0xff, 0xe0, 0xff, 0xff, 0xe0, 0xff, 0xe0, 0xe0,
+    0xff, 0xe7, 0xe7, 0xe7, 0xe0, 0xe7, 0xe7, 0xef,
+    0xff, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xe0, 0xff,
+    0xff, 0xb0, 0x60, 0x6f, 0x2f, 0x27, 0x80, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_name_gam_pages = {
+    .format = RESOURCE_FORMAT_PAGES,
+    .width  = 64,
+    .height = 16,
+    .size   = sizeof(resource_name_gam_pages_data),
+    .data   = resource_name_gam_pages_data
+};
+
+// name-mac.pbm, 64x16, in page order
+static const uint8_t resource_name_mac_pages_data[128] = {
+    0x1f, 0x9f, 0x9f, 0x3f, 0x9f, 0x1f, 0x3f, 0xff,
+    0xbf, 0x9f, 0x9f, 0x9f, 0x9f, 0x3f, 0xff, 0xff,
+    0x3f, 0x1f, 0x9f, 0x9f, 0x9f, 0x3f, 0xff, 0xff,
+    0x0f, 0x07, 0xe7, 0xe7, 0xe7, 0x0f, 0xff, 0xff,
+    0x3f, 0x1f, 0x9f, 0x9f, 0x9f, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0xff, 0xff, 0xe0, 0xff, 0xe0, 0xe0, 0xff,
+    0xf1, 0xe0, 0xe4, 0xe4, 0xf4, 0xe0, 0xff, 0xff,
+    0xf0, 0xe0, 0xe7, 0xe7, 0xe7, 0xf3, 0xff, 0xff,
+    0xf0, 0xe0, 0xe7, 0xe7, 0xe7, 0xf0, 0xff, 0xff,
+    0xf7, 0xe6, 0xe4, 0xec, 0xe5, 0xf1, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_name_mac_pages = {
+    .format = RESOURCE_FORMAT_PAGES,
+    .width  = 64,
+    .height = 16,
+    .size   = sizeof(resource_name_mac_pages_data),
+    .data   = resource_name_mac_pages_data
+};
+
+// name-win.pbm, 64x16, in page order
+static const uint8_t resource_name_win_pages_data[128] = {
+    0xc7, 0x07, 0xff, 0x07, 0x87, 0xff, 0x1f, 0x07,
+    0xff, 0xdf, 0x9f, 0x97, 0x17, 0xff, 0xff, 0xff,
+    0xff, 0x1f, 0x1f, 0xbf, 0x9f, 0x1f, 0x3f, 0xff,
+    0xff, 0x3f, 0x1f, 0x9f, 0x9f, 0x3f, 0x07, 0xff,
+    0xff, 0x3f, 0x1f, 0x9f, 0x9f, 0x9f, 0x3f, 0xff,
+    0x9f, 0x1f, 0xff, 0x1f, 0x1f, 0xff, 0x7f, 0x1f,
+    0xff, 0x3f, 0x1f, 0x9f, 0x9f, 0x9f, 0xbf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0xe1, 0xf8, 0xff, 0xe0, 0xe0, 0xfe,
+    0xff, 0xe7, 0xe7, 0xe7, 0xe0, 0xe7, 0xe7, 0xef,
+    0xff, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xe0, 0xff,
+    0xff, 0xf0, 0xe0, 0xe7, 0xe7, 0xf3, 0xe0, 0xff,
+    0xff, 0xf0, 0xe0, 0xe7, 0xe7, 0xe7, 0xf0, 0xff,
+    0xff, 0xe0, 0xe3, 0xf8, 0xfe, 0xe1, 0xe0, 0xfe,
+    0xff, 0xf7, 0xe6, 0xe4, 0xec, 0xe5, 0xf1, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_name_win_pages = {
+    .format = RESOURCE_FORMAT_PAGES,
+    .width  = 64,
+    .height = 16,
+    .size   = sizeof(resource_name_win_pages_data),
+    .data   = resource_name_win_pages_data
+};
+
+// symbol-controller.pbm, 32x32, in page order
+static const uint8_t resource_symbol_controller_pages_data[128] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x7f, 0xbf, 0xdf, 0xdf, 0xdf, 0xbf, 0x7f,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x0f, 0x07, 0xc7, 0xc3, 0x07, 0x07, 0x0f, 0x8f,
+    0x0f, 0x00, 0x0f, 0x8f, 0x07, 0x07, 0x83, 0x47,
+    0x87, 0x0f, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xc2, 0xe7, 0xe2, 0xe0,
+    0xe0, 0xe0, 0xe0, 0xe0, 0xe6, 0xc6, 0x80, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_symbol_controller_pages = {
+    .format = RESOURCE_FORMAT_PAGES,
+    .width  = 32,
+    .height = 32,
+    .size   = sizeof(resource_symbol_controller_pages_data),
+    .data   = resource_symbol_controller_pages_data
+};
+
+// symbol-keyboard.pbm, 32x32, in page order
+static const uint8_t resource_symbol_keyboard_pages_data[128] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+    0xbf, 0xdf, 0xdf, 0xdf, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0f, 0xcf,
+    0xcf, 0x0f, 0xcf, 0xcf, 0x0f, 0xcf, 0xcf, 0x0c,
+    0xc3, 0xcf, 0x0f, 0xcf, 0xcf, 0x0f, 0xcf, 0xcf,
+    0x0f, 0xcf, 0xcf, 0x0f, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x36,
+    0x36, 0x00, 0x36, 0x36, 0x00, 0xb6, 0xb6, 0x80,
+    0xb6, 0xb6, 0x80, 0xb6, 0xb6, 0x00, 0x36, 0x36,
+    0x00, 0x36, 0x36, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff
+};
+
+__attribute__((weak)) const resource_bitmap_t resource_symbol_keyboard_pages = {
+    .format = RESOURCE_FORMAT_PAGES,
+    .width  = 32,
+    .height = 32,
+    .size   = sizeof(resource_symbol_keyboard_pages_data),
+    .data   = resource_symbol_keyboard_pages_data
+};
+
+// dejavusansbold12.pbm, 10 glyphs ".Sdeginpsu", 63x12
+static const uint8_t resource_font_dejavusansbold12_atlas_data[96] = {
+    0xf0, 0x7e, 0x7f, 0xff, 0x3f, 0xff, 0xff, 0xfe,
+    0xe7, 0x3e, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xe7, 0xf2, 0x61, 0xc9, 0x24, 0xc9, 0xc3, 0x32,
+    0xe3, 0xe4, 0x4c, 0x91, 0x22, 0x44, 0x99, 0x32,
+    0xf0, 0x66, 0x4c, 0x99, 0x26, 0x4c, 0x8f, 0x32,
+    0xfe, 0x26, 0x40, 0x99, 0x26, 0x4c, 0xc3, 0x32,
+    0xff, 0x26, 0x4f, 0x99, 0x26, 0x4c, 0xf1, 0x32,
+    0x27, 0x24, 0x4e, 0x91, 0x26, 0x44, 0x99, 0x22,
+    0x30, 0x72, 0x61, 0xc9, 0x26, 0x49, 0xc3, 0x92,
+    0xff, 0xff, 0xff, 0xf9, 0xff, 0xcf, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0x99, 0xff, 0xcf, 0xff, 0xfe,
+    0xff, 0xff, 0xff, 0xc3, 0xff, 0xcf, 0xff, 0xfe
+};
+
+static const resource_bitmap_t resource_font_dejavusansbold12_atlas = {
+    .format = RESOURCE_FORMAT_RAW,
+    .width  = 63,
+    .height = 12,
+    .size   = sizeof(resource_font_dejavusansbold12_atlas_data),
+    .data   = resource_font_dejavusansbold12_atlas_data
+};
+
+static const resource_glyph_t resource_font_dejavusansbold12_glyphs[10] = {
+    {'.', 0, 3},
+    {'S', 3, 8},
+    {'d', 11, 7},
+    {'e', 18, 7},
+    {'g', 25, 7},
+    {'i', 32, 3},
+    {'n', 35, 7},
+    {'p', 42, 7},
+    {'s', 49, 7},
+    {'u', 56, 7}
+};
+
+__attribute__((weak)) const resource_font_t resource_font_dejavusansbold12 = {
+    .atlas      = &resource_font_dejavusansbold12_atlas,
+    .glyphs     = resource_font_dejavusansbold12_glyphs,
+    .num_glyphs = 10
+};
+#endif
@@ -14,22 +14,89 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+/**
+ * Generated by generate-resources.py from the images in images/, don't edit
+ * this file. Add or change an image and run
+ *      make <keyboard>:<keymap>:visualizer-resources
+ * instead.
+*/
+
 #pragma once
 
 #include <stdint.h>
 
 #ifdef LCD_ENABLE
+/**
+ * How the data of a resource_bitmap_t is stored
+ *
+ * RESOURCE_FORMAT_RAW: 1 bit per pixel, 8 pixels per byte, most significant
+ *      bit first, row by row, the same format as resource_lcd_logo
+ * RESOURCE_FORMAT_PACKBITS: the raw format compressed with PackBits. Each
+ *      run starts with a header byte n. For n = 0..127 the next n + 1 bytes
+ *      are copied as they are, for n = 129..255 the next byte is repeated
+ *      257 - n times, n = 128 is ignored.
+ * RESOURCE_FORMAT_PAGES: the order of the LCD controller's memory. The
+ *      bitmap is cut into pages 8 pixels tall, stored one after the other.
+ *      Each page holds one byte per column, the top pixel being the least
+ *      significant bit. The width can't be larger than the LCD's.
+*/
+typedef enum {
+    RESOURCE_FORMAT_RAW,
+    RESOURCE_FORMAT_PACKBITS,
+    RESOURCE_FORMAT_PAGES,
+} resource_format_t;
+
+typedef struct {
+    resource_format_t format;
+    uint8_t           width;
+    uint8_t           height;
+    uint16_t          size; // bytes of data, not pixels
+    const uint8_t*    data;
+} resource_bitmap_t;
+
+/**
+ * A font of pre-rasterized glyphs. They sit side by side in the atlas, a
+ * RESOURCE_FORMAT_RAW bitmap as tall as the font, and the width of every
+ * glyph includes the space that follows it.
+*/
+typedef struct {
+    char    character;
+    uint8_t x;  // first column of the glyph in the atlas
+    uint8_t width;
+} resource_glyph_t;
+
+typedef struct {
+    const resource_bitmap_t* atlas;
+    const resource_glyph_t*  glyphs;  // sorted by character
+    uint8_t                  num_glyphs;
+} resource_font_t;
+
 extern const uint8_t resource_lcd_logo[];
-extern const uint8_t resource_logo_win[];
-extern const uint8_t resource_logo_mac[];
-extern const uint8_t resource_logo_cod[];
-extern const uint8_t resource_name_win[];
-extern const uint8_t resource_name_mac[];
-extern const uint8_t resource_name_gam[];
-extern const uint8_t resource_name_cod[];
-extern const uint8_t resource_symbol_keyboard[];
-extern const uint8_t resource_symbol_controller[];
-extern const uint8_t resource_mode_mode[];
-extern const uint8_t resource_mode_cod[];
-extern const uint8_t resource_mode_fn[];
+extern const resource_bitmap_t resource_logo_cod;
+extern const resource_bitmap_t resource_logo_gam;
+extern const resource_bitmap_t resource_logo_mac;
+extern const resource_bitmap_t resource_mode_cod;
+extern const resource_bitmap_t resource_mode_fn;
+extern const resource_bitmap_t resource_mode_mode;
+extern const resource_bitmap_t resource_name_cod;
+extern const resource_bitmap_t resource_name_gam;
+extern const resource_bitmap_t resource_name_mac;
+extern const resource_bitmap_t resource_name_win;
+extern const resource_bitmap_t resource_symbol_controller;
+extern const resource_bitmap_t resource_symbol_keyboard;
+#define resource_logo_win resource_logo_gam // same image as logo-gam.pbm
+extern const resource_bitmap_t resource_logo_cod_pages;
+extern const resource_bitmap_t resource_logo_gam_pages;
+extern const resource_bitmap_t resource_logo_mac_pages;
+extern const resource_bitmap_t resource_mode_cod_pages;
+extern const resource_bitmap_t resource_mode_fn_pages;
+extern const resource_bitmap_t resource_mode_mode_pages;
+extern const resource_bitmap_t resource_name_cod_pages;
+extern const resource_bitmap_t resource_name_gam_pages;
+extern const resource_bitmap_t resource_name_mac_pages;
+extern const resource_bitmap_t resource_name_win_pages;
+extern const resource_bitmap_t resource_symbol_controller_pages;
+extern const resource_bitmap_t resource_symbol_keyboard_pages;
+#define resource_logo_win_pages resource_logo_gam_pages // same image as logo-gam.pbm
+extern const resource_font_t resource_font_dejavusansbold12;
 #endif
@@ -1,64 +0,0 @@
-
-/*******************************************************************************
-* image
-* filename: unsaved
-* name: symbol-controller
-*
-* preset name: Monochrome
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Edge 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
-/*
- typedef struct {
-     const uint8_t *data;
-     uint16_t width;
-     uint16_t height;
-     uint8_t dataSize;
-     } tImage;
-*/
-#include "resources.h"
-
-
-
-__attribute__((weak)) const uint8_t resource_symbol_controller[128] = {
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xe3, 0xff, 
-    0xff, 0xff, 0xdd, 0x7f, 
-    0xff, 0xff, 0xbe, 0xff, 
-    0xff, 0xff, 0xbf, 0xff, 
-    0xff, 0xff, 0xbf, 0xff, 
-    0xff, 0xef, 0xbd, 0xff, 
-    0xff, 0x83, 0xb0, 0x7f, 
-    0xff, 0x00, 0x00, 0x3f, 
-    0xfe, 0x00, 0x00, 0x1f, 
-    0xfe, 0x30, 0x01, 0x1f, 
-    0xfe, 0x31, 0x12, 0x9f, 
-    0xfc, 0x04, 0x01, 0x0f, 
-    0xfc, 0x0e, 0x0c, 0x0f, 
-    0xfc, 0x04, 0x0c, 0x0f, 
-    0xf8, 0x00, 0x00, 0x07, 
-    0xf8, 0x00, 0x00, 0x07, 
-    0xf8, 0x07, 0xf8, 0x07, 
-    0xf8, 0x0f, 0xfc, 0x07, 
-    0xf8, 0x1f, 0xfe, 0x07, 
-    0xfc, 0x3f, 0xff, 0x0f, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff
-};
@@ -1,64 +0,0 @@
-
-/*******************************************************************************
-* image
-* filename: unsaved
-* name: symbol-keyboard
-*
-* preset name: Monochrome
-* data block size: 8 bit(s), uint8_t
-* RLE compression enabled: no
-* conversion type: Monochrome, Edge 128
-* bits per pixel: 1
-*
-* preprocess:
-*  main scan direction: top_to_bottom
-*  line scan direction: forward
-*  inverse: no
-*******************************************************************************/
-
-/*
- typedef struct {
-     const uint8_t *data;
-     uint16_t width;
-     uint16_t height;
-     uint8_t dataSize;
-     } tImage;
-*/
-#include "resources.h"
-
-
-
-__attribute__((weak)) const uint8_t resource_symbol_keyboard[128] = {
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0x87, 0xff, 
-    0xff, 0xff, 0x7f, 0xff, 
-    0xff, 0xfe, 0xff, 0xff, 
-    0xff, 0xfe, 0xff, 0xff, 
-    0xff, 0xfe, 0xff, 0xff, 
-    0xff, 0xff, 0x7f, 0xff, 
-    0xff, 0xff, 0x7f, 0xff, 
-    0xfc, 0x00, 0x00, 0x0f, 
-    0xf8, 0x00, 0x00, 0x07, 
-    0xf9, 0xb6, 0xdb, 0x67, 
-    0xf9, 0xb6, 0xdb, 0x67, 
-    0xf8, 0x00, 0x00, 0x07, 
-    0xf9, 0xb6, 0xdb, 0x67, 
-    0xf9, 0xb6, 0xdb, 0x67, 
-    0xf8, 0x00, 0x00, 0x07, 
-    0xf9, 0xb6, 0xdb, 0x67, 
-    0xf9, 0xb6, 0xdb, 0x67, 
-    0xf8, 0x00, 0x00, 0x07, 
-    0xf8, 0x07, 0xf8, 0x07, 
-    0xfc, 0x00, 0x00, 0x0f, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff
-};
@@ -0,0 +1,906 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2016 Fred Sundvik
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "config.h"
+#include "visualizer.h"
+#include <string.h>
+#ifdef PROTOCOL_CHIBIOS
+#    include "ch.h"
+#endif
+
+#include "gfx.h"
+
+#ifdef LCD_BACKLIGHT_ENABLE
+#    include "lcd_backlight.h"
+#endif
+
+//#define DEBUG_VISUALIZER
+
+#ifdef DEBUG_VISUALIZER
+#    include "debug.h"
+#else
+#    include "nodebug.h"
+#endif
+
+#ifdef SERIAL_LINK_ENABLE
+#    include "serial_link/protocol/transport.h"
+#    include "serial_link/system/serial_link.h"
+#endif
+
+#include "action_util.h"
+
+// Define this in config.h
+#ifndef VISUALIZER_THREAD_PRIORITY
+// The visualizer needs gfx thread priorities
+#    define VISUALIZER_THREAD_PRIORITY (NORMAL_PRIORITY - 2)
+#endif
+
+static visualizer_keyboard_status_t current_status = {.layer         = 0xFFFFFFFF,
+                                                      .default_layer = 0xFFFFFFFF,
+                                                      .leds          = 0xFFFFFFFF,
+#ifdef BACKLIGHT_ENABLE
+                                                      .backlight_level = 0,
+#endif
+                                                      .mods      = 0xFF,
+                                                      .suspended = false,
+#ifdef VISUALIZER_USER_DATA_SIZE
+                                                      .user_data = {0}
+#endif
+};
+
+// When current_status last changed, see visualizer_state_t.status_time
+static systemticks_t current_status_time = 0;
+
+// current_status and current_status_time belong to the thread calling
+// visualizer_update, the visualizer thread reads a snapshot of them that
+// update_status publishes.
+typedef struct {
+    visualizer_keyboard_status_t status;
+    systemticks_t                time;
+} status_snapshot_t;
+
+// The snapshot is double buffered, published_status[(status_sequence >> 1) & 1]
+// is the current one. status_sequence is odd while the other one is written,
+// so the visualizer thread can copy the current one meanwhile. It only has to
+// copy again when it was interrupted for long enough that the writer had
+// moved on to its buffer. Neither side ever waits for the other.
+static status_snapshot_t published_status[2];
+static uint32_t          status_sequence = 0;
+
+static void publish_status(void) {
+    uint32_t           sequence = __atomic_load_n(&status_sequence, __ATOMIC_RELAXED);
+    status_snapshot_t* next     = &published_status[((sequence >> 1) + 1) & 1];
+
+    __atomic_store_n(&status_sequence, sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    next->status = current_status;
+    next->time   = current_status_time;
+    __atomic_store_n(&status_sequence, sequence + 2, __ATOMIC_RELEASE);
+}
+
+static void read_published_status(status_snapshot_t* snapshot) {
+    uint32_t sequence;
+    do {
+        sequence  = __atomic_load_n(&status_sequence, __ATOMIC_ACQUIRE);
+        *snapshot = published_status[(sequence >> 1) & 1];
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        // The writer starts on the buffer that was copied three steps after
+        // it was published
+    } while (__atomic_load_n(&status_sequence, __ATOMIC_RELAXED) - (sequence & ~1u) >= 3);
+}
+
+// Returns the VISUALIZER_STATUS_ fields that differ
+static uint8_t status_changes(visualizer_keyboard_status_t* status1, visualizer_keyboard_status_t* status2) {
+    uint8_t changes = 0;
+    if (status1->layer != status2->layer) changes |= VISUALIZER_STATUS_LAYER;
+    if (status1->default_layer != status2->default_layer) changes |= VISUALIZER_STATUS_DEFAULT_LAYER;
+    if (status1->mods != status2->mods) changes |= VISUALIZER_STATUS_MODS;
+    if (status1->leds != status2->leds) changes |= VISUALIZER_STATUS_LEDS;
+    if (status1->suspended != status2->suspended) changes |= VISUALIZER_STATUS_SUSPENDED;
+#ifdef BACKLIGHT_ENABLE
+    if (status1->backlight_level != status2->backlight_level) changes |= VISUALIZER_STATUS_BACKLIGHT;
+#endif
+#ifdef VISUALIZER_USER_DATA_SIZE
+    if (memcmp(status1->user_data, status2->user_data, VISUALIZER_USER_DATA_SIZE) != 0) changes |= VISUALIZER_STATUS_USER_DATA;
+#endif
+    return changes;
+}
+
+static uint8_t subscribed_fields = VISUALIZER_STATUS_ALL;
+// Whatever the user code subscribes to, these are handled by the visualizer itself
+static const uint8_t visualizer_fields = VISUALIZER_STATUS_SUSPENDED | VISUALIZER_STATUS_BACKLIGHT;
+
+static bool visualizer_enabled = false;
+
+#ifdef VISUALIZER_USER_DATA_SIZE
+static uint8_t user_data[VISUALIZER_USER_DATA_SIZE];
+#endif
+
+#define MAX_SIMULTANEOUS_ANIMATIONS 4
+static keyframe_animation_t* animations[MAX_SIMULTANEOUS_ANIMATIONS] = {};
+// Set whenever an animation is (re)started, not when it's refused for lack of a
+// slot, see update_keyframe_animations
+static bool animations_started = false;
+
+#ifdef SERIAL_LINK_ENABLE
+// The status is sent to the slaves in parts, so that a key press only sends
+// the part it changed. Every part is stamped with the generation it was sent
+// in, and which parts that generation changed. The slaves only show a
+// generation once all of its parts have arrived, so they never show half of
+// an update. All the parts are sent at least every
+// VISUALIZER_STATUS_KEYFRAME_MS, which brings a slave that missed something
+// back in sync.
+#    ifndef VISUALIZER_STATUS_KEYFRAME_MS
+#        define VISUALIZER_STATUS_KEYFRAME_MS 500
+#    endif
+
+// A part can be this many generations older than the newest one received
+// while it's still on its way. A keyframe that's even older than that means
+// that the master has started over.
+#    define STATUS_GENERATIONS_IN_FLIGHT 16
+
+enum {
+    STATUS_PART_LAYERS = 1 << 0,
+    STATUS_PART_INPUT  = 1 << 1,
+#    ifdef VISUALIZER_USER_DATA_SIZE
+    STATUS_PART_USER_DATA = 1 << 2,
+    STATUS_PART_ALL       = STATUS_PART_LAYERS | STATUS_PART_INPUT | STATUS_PART_USER_DATA,
+#    else
+    STATUS_PART_ALL = STATUS_PART_LAYERS | STATUS_PART_INPUT,
+#    endif
+};
+
+typedef struct {
+    uint8_t  generation;
+    uint8_t  parts;  // The parts sent in this generation
+    uint32_t time;   // When the master's status changed, in the master's ticks
+} status_stamp_t;
+
+typedef struct {
+    status_stamp_t stamp;
+    layer_state_t  layer;
+    layer_state_t  default_layer;
+} status_layers_t;
+
+typedef struct {
+    status_stamp_t stamp;
+    uint32_t       leds;
+    uint8_t        mods;
+    bool           suspended;
+#    ifdef BACKLIGHT_ENABLE
+    uint8_t backlight_level;
+#    endif
+} status_input_t;
+
+#    ifdef VISUALIZER_USER_DATA_SIZE
+typedef struct {
+    status_stamp_t stamp;
+    uint8_t        user_data[VISUALIZER_USER_DATA_SIZE];
+} status_user_data_t;
+#    endif
+
+MASTER_TO_ALL_SLAVES_OBJECT(status_layers, status_layers_t);
+MASTER_TO_ALL_SLAVES_OBJECT(status_input, status_input_t);
+#    ifdef VISUALIZER_USER_DATA_SIZE
+MASTER_TO_ALL_SLAVES_OBJECT(status_user_data, status_user_data_t);
+#    endif
+
+static remote_object_t* remote_objects[] = {
+    REMOTE_OBJECT(status_layers),
+    REMOTE_OBJECT(status_input),
+#    ifdef VISUALIZER_USER_DATA_SIZE
+    REMOTE_OBJECT(status_user_data),
+#    endif
+};
+
+static uint8_t changed_status_parts(visualizer_keyboard_status_t* status1, visualizer_keyboard_status_t* status2) {
+    uint8_t changes = status_changes(status1, status2);
+    uint8_t parts   = 0;
+    if (changes & (VISUALIZER_STATUS_LAYER | VISUALIZER_STATUS_DEFAULT_LAYER)) {
+        parts |= STATUS_PART_LAYERS;
+    }
+    if (changes & (VISUALIZER_STATUS_MODS | VISUALIZER_STATUS_LEDS | VISUALIZER_STATUS_SUSPENDED | VISUALIZER_STATUS_BACKLIGHT)) {
+        parts |= STATUS_PART_INPUT;
+    }
+#    ifdef VISUALIZER_USER_DATA_SIZE
+    if (changes & VISUALIZER_STATUS_USER_DATA) {
+        parts |= STATUS_PART_USER_DATA;
+    }
+#    endif
+    return parts;
+}
+
+static void send_status_parts(uint8_t parts) {
+    static uint8_t       generation = 0;
+    const status_stamp_t stamp      = {.generation = ++generation, .parts = parts, .time = current_status_time};
+
+    if (parts & STATUS_PART_LAYERS) {
+        status_layers_t* r = begin_write_status_layers();
+        r->stamp           = stamp;
+        r->layer           = current_status.layer;
+        r->default_layer   = current_status.default_layer;
+        end_write_status_layers();
+    }
+    if (parts & STATUS_PART_INPUT) {
+        status_input_t* r = begin_write_status_input();
+        r->stamp          = stamp;
+        r->leds           = current_status.leds;
+        r->mods           = current_status.mods;
+        r->suspended      = current_status.suspended;
+#    ifdef BACKLIGHT_ENABLE
+        r->backlight_level = current_status.backlight_level;
+#    endif
+        end_write_status_input();
+    }
+#    ifdef VISUALIZER_USER_DATA_SIZE
+    if (parts & STATUS_PART_USER_DATA) {
+        status_user_data_t* r = begin_write_status_user_data();
+        r->stamp              = stamp;
+        memcpy(r->user_data, current_status.user_data, VISUALIZER_USER_DATA_SIZE);
+        end_write_status_user_data();
+    }
+#    endif
+}
+
+// The parts received from the master, they are only read when they change
+static status_layers_t received_layers;
+static status_input_t  received_input;
+#    ifdef VISUALIZER_USER_DATA_SIZE
+static status_user_data_t received_user_data;
+#    endif
+static status_stamp_t newest_stamp;
+// Nothing is shown until the first keyframe, until then the parts that
+// haven't been received are unknown
+static bool status_synced = false;
+
+// The master's ticks plus master_clock_offset are this half's ticks, give or
+// take the shortest time a part has taken to arrive. Parts that aren't part of
+// a keyframe are sent right when the status changed, so the offset is the
+// smallest difference between their arrival and their time. The smallest one
+// of the last CLOCK_OFFSET_KEYFRAMES keyframe intervals is used, which follows
+// the clocks drifting apart. It only changes at keyframes: with a single
+// interval, or taking every shorter offset at once, it would move by a tick or
+// two every now and then, and the halves would disagree about the time
+// between two layer changes.
+#    define CLOCK_OFFSET_KEYFRAMES 8
+
+static systemticks_t master_clock_offset;
+static bool          master_clock_known = false;
+// The smallest offset of each interval, the current one is shortest_offsets[offset_interval]
+static systemticks_t shortest_offsets[CLOCK_OFFSET_KEYFRAMES];
+static uint8_t       shortest_offsets_known = 0;
+static uint8_t       offset_interval        = 0;
+// Every part of a keyframe ends the interval, only the first one counts
+static uint8_t       offset_keyframe_generation;
+static bool          offset_keyframe_received = false;
+
+_Static_assert(CLOCK_OFFSET_KEYFRAMES <= 8, "shortest_offsets_known has a bit per interval");
+
+// The offsets can be anywhere on the clock, so they're compared by difference
+static bool is_shorter_offset(systemticks_t offset, systemticks_t than) { return (int32_t)(offset - than) < 0; }
+
+static void receive_clock(status_stamp_t stamp) {
+    if (stamp.parts == STATUS_PART_ALL) {
+        if (offset_keyframe_received && stamp.generation == offset_keyframe_generation) {
+            return;
+        }
+        offset_keyframe_generation = stamp.generation;
+        offset_keyframe_received   = true;
+
+        bool known = false;
+        for (uint8_t i = 0; i < CLOCK_OFFSET_KEYFRAMES; i++) {
+            if (!(shortest_offsets_known & (1 << i))) {
+                continue;
+            }
+            if (!known || is_shorter_offset(shortest_offsets[i], master_clock_offset)) {
+                master_clock_offset = shortest_offsets[i];
+            }
+            known = true;
+        }
+        master_clock_known |= known;
+        offset_interval = (offset_interval + 1) % CLOCK_OFFSET_KEYFRAMES;
+        shortest_offsets_known &= ~(1 << offset_interval);
+        return;
+    }
+
+    systemticks_t offset = gfxSystemTicks() - stamp.time;
+    if (!(shortest_offsets_known & (1 << offset_interval)) || is_shorter_offset(offset, shortest_offsets[offset_interval])) {
+        shortest_offsets[offset_interval] = offset;
+        shortest_offsets_known |= 1 << offset_interval;
+    }
+    // Nothing is shown before the first keyframe, until then every shorter one is taken
+    if (!offset_keyframe_received && (!master_clock_known || is_shorter_offset(offset, master_clock_offset))) {
+        master_clock_offset = offset;
+        master_clock_known  = true;
+    }
+}
+
+static void receive_stamp(status_stamp_t stamp) {
+    receive_clock(stamp);
+
+    int8_t age = newest_stamp.generation - stamp.generation;
+    if (age < 0 || (stamp.parts == STATUS_PART_ALL && (age > STATUS_GENERATIONS_IN_FLIGHT || !status_synced))) {
+        newest_stamp = stamp;
+    }
+}
+
+static bool has_part(uint8_t part, status_stamp_t stamp) { return !(newest_stamp.parts & part) || stamp.generation == newest_stamp.generation; }
+
+// Reads the parts that have arrived, and returns true when they add up to a
+// whole generation, which is then copied to status, and when it changed to
+// time
+static bool receive_status(visualizer_keyboard_status_t* status, systemticks_t* time) {
+    status_layers_t* layers = read_status_layers();
+    if (layers) {
+        received_layers = *layers;
+        receive_stamp(layers->stamp);
+    }
+    status_input_t* input = read_status_input();
+    if (input) {
+        received_input = *input;
+        receive_stamp(input->stamp);
+    }
+#    ifdef VISUALIZER_USER_DATA_SIZE
+    status_user_data_t* user_data = read_status_user_data();
+    if (user_data) {
+        received_user_data = *user_data;
+        receive_stamp(user_data->stamp);
+    }
+#    endif
+    if (!layers && !input
+#    ifdef VISUALIZER_USER_DATA_SIZE
+        && !user_data
+#    endif
+    ) {
+        return false;
+    }
+
+    bool complete = has_part(STATUS_PART_LAYERS, received_layers.stamp) && has_part(STATUS_PART_INPUT, received_input.stamp)
+#    ifdef VISUALIZER_USER_DATA_SIZE
+                    && has_part(STATUS_PART_USER_DATA, received_user_data.stamp)
+#    endif
+        ;
+    if (!complete || (!status_synced && newest_stamp.parts != STATUS_PART_ALL)) {
+        return false;
+    }
+    status_synced = true;
+
+    status->layer         = received_layers.layer;
+    status->default_layer = received_layers.default_layer;
+    status->leds          = received_input.leds;
+    status->mods          = received_input.mods;
+    status->suspended     = received_input.suspended;
+#    ifdef BACKLIGHT_ENABLE
+    status->backlight_level = received_input.backlight_level;
+#    endif
+#    ifdef VISUALIZER_USER_DATA_SIZE
+    memcpy(status->user_data, received_user_data.user_data, VISUALIZER_USER_DATA_SIZE);
+#    endif
+    *time = master_clock_known ? newest_stamp.time + master_clock_offset : gfxSystemTicks();
+    return true;
+}
+#endif
+
+GDisplay* LCD_DISPLAY = 0;
+GDisplay* LED_DISPLAY = 0;
+
+#ifdef LCD_DISPLAY_NUMBER
+__attribute__((weak)) GDisplay* get_lcd_display(void) { return gdispGetDisplay(LCD_DISPLAY_NUMBER); }
+#endif
+
+#ifdef LED_DISPLAY_NUMBER
+__attribute__((weak)) GDisplay* get_led_display(void) { return gdispGetDisplay(LED_DISPLAY_NUMBER); }
+#endif
+
+// Finds the run that frame belongs to, there are only ever a few runs so
+// they are simply searched from the start
+static const keyframe_run_t* get_keyframe_run(keyframe_animation_t* animation, int frame) {
+    for (int i = 0; i < animation->num_runs; i++) {
+        if (frame < animation->runs[i].repeat) {
+            return &animation->runs[i];
+        }
+        frame -= animation->runs[i].repeat;
+    }
+    return &animation->runs[animation->num_runs - 1];
+}
+
+static int get_frame_length(keyframe_animation_t* animation, int frame) {
+    if (animation->runs) {
+        return get_keyframe_run(animation, frame)->length;
+    }
+    return animation->frame_lengths[frame];
+}
+
+static frame_func get_frame_function(keyframe_animation_t* animation, int frame) {
+    if (animation->runs) {
+        return get_keyframe_run(animation, frame)->function;
+    }
+    return animation->frame_functions[frame];
+}
+
+void start_keyframe_animation(keyframe_animation_t* animation) {
+    if (animation->runs) {
+        animation->num_frames = 0;
+        for (int i = 0; i < animation->num_runs; i++) {
+            animation->num_frames += animation->runs[i].repeat;
+        }
+    }
+    animation->current_frame      = -1;
+    animation->time_left_in_frame = 0;
+    animation->need_update        = true;
+    int free_index                = -1;
+    int lowest_index              = 0;
+    for (int i = 0; i < MAX_SIMULTANEOUS_ANIMATIONS; i++) {
+        if (animations[i] == animation) {
+            // Already running, it simply starts over from the first frame
+            animations_started = true;
+            return;
+        }
+        if (free_index == -1 && animations[i] == NULL) {
+            free_index = i;
+        }
+        if (animations[i] && animations[lowest_index] && animations[i]->priority < animations[lowest_index]->priority) {
+            lowest_index = i;
+        }
+    }
+    if (free_index == -1 && animations[lowest_index]->priority < animation->priority) {
+        // All slots are taken, the animation with the lowest priority gives way
+        dprintf("Animation preempted by one with priority %d\n", animation->priority);
+        free_index = lowest_index;
+        stop_keyframe_animation(animations[lowest_index]);
+    }
+    if (free_index != -1) {
+        animations[free_index] = animation;
+        animations_started     = true;
+    }
+}
+
+void stop_keyframe_animation(keyframe_animation_t* animation) {
+    animation->current_frame         = animation->num_frames;
+    animation->time_left_in_frame    = 0;
+    animation->need_update           = true;
+    animation->first_update_of_frame = false;
+    animation->last_update_of_frame  = false;
+    for (int i = 0; i < MAX_SIMULTANEOUS_ANIMATIONS; i++) {
+        if (animations[i] == animation) {
+            animations[i] = NULL;
+            return;
+        }
+    }
+}
+
+void stop_all_keyframe_animations(void) {
+    for (int i = 0; i < MAX_SIMULTANEOUS_ANIMATIONS; i++) {
+        if (animations[i]) {
+            animations[i]->current_frame         = animations[i]->num_frames;
+            animations[i]->time_left_in_frame    = 0;
+            animations[i]->need_update           = true;
+            animations[i]->first_update_of_frame = false;
+            animations[i]->last_update_of_frame  = false;
+            animations[i]                        = NULL;
+        }
+    }
+}
+
+static uint8_t get_num_running_animations(void) {
+    uint8_t count = 0;
+    for (int i = 0; i < MAX_SIMULTANEOUS_ANIMATIONS; i++) {
+        count += animations[i] ? 1 : 0;
+    }
+    return count;
+}
+
+static bool update_keyframe_animation(keyframe_animation_t* animation, visualizer_state_t* state, systemticks_t delta, systemticks_t* sleep_time) {
+    // TODO: Clean up this messy code
+    dprintf("Animation frame%d, left %d, delta %d\n", animation->current_frame, animation->time_left_in_frame, delta);
+    if (animation->current_frame == animation->num_frames) {
+        animation->need_update = false;
+        return false;
+    }
+    if (animation->current_frame == -1) {
+        animation->current_frame         = 0;
+        animation->time_left_in_frame    = get_frame_length(animation, 0);
+        animation->need_update           = true;
+        animation->first_update_of_frame = true;
+    } else {
+        animation->time_left_in_frame -= delta;
+        while (animation->time_left_in_frame <= 0) {
+            int left = animation->time_left_in_frame;
+            if (animation->need_update) {
+                animation->time_left_in_frame   = 0;
+                animation->last_update_of_frame = true;
+                (*get_frame_function(animation, animation->current_frame))(animation, state);
+                animation->last_update_of_frame = false;
+            }
+            animation->current_frame++;
+            animation->need_update           = true;
+            animation->first_update_of_frame = true;
+            if (animation->current_frame == animation->num_frames) {
+                if (animation->loop) {
+                    animation->current_frame = 0;
+                } else {
+                    stop_keyframe_animation(animation);
+                    return false;
+                }
+            }
+            delta                         = -left;
+            animation->time_left_in_frame = get_frame_length(animation, animation->current_frame);
+            animation->time_left_in_frame -= delta;
+        }
+    }
+    if (animation->need_update) {
+        animation->need_update           = (*get_frame_function(animation, animation->current_frame))(animation, state);
+        animation->first_update_of_frame = false;
+    }
+
+    systemticks_t wanted_sleep = animation->need_update ? gfxMillisecondsToTicks(10) : (unsigned)animation->time_left_in_frame;
+    if (wanted_sleep < *sleep_time) {
+        *sleep_time = wanted_sleep;
+    }
+
+    return true;
+}
+
+// Updates all running animations in a single pass, the lowest priority
+// first, so that the ones with a higher priority draw on top of them.
+// Afterwards the sleep_time is the earliest time any of them needs an update.
+static void update_keyframe_animations(visualizer_state_t* state, systemticks_t delta, systemticks_t* sleep_time) {
+    animations_started = false;
+    // A copy, since the animations can stop or start others
+    keyframe_animation_t* pass[MAX_SIMULTANEOUS_ANIMATIONS];
+    int                   num_animations = 0;
+    for (int i = 0; i < MAX_SIMULTANEOUS_ANIMATIONS; i++) {
+        if (animations[i]) {
+            int j = num_animations++;
+            for (; j > 0 && pass[j - 1]->priority > animations[i]->priority; j--) {
+                pass[j] = pass[j - 1];
+            }
+            pass[j] = animations[i];
+        }
+    }
+    for (int i = 0; i < num_animations; i++) {
+        update_keyframe_animation(pass[i], state, delta, sleep_time);
+    }
+    // Animations started during the pass haven't had their first update yet
+    if (animations_started) {
+        *sleep_time = 0;
+    }
+}
+
+__attribute__((weak)) void user_visualizer_flush(visualizer_state_t* state) { (void)state; }
+
+void run_next_keyframe(keyframe_animation_t* animation, visualizer_state_t* state) {
+    int next_frame = animation->current_frame + 1;
+    if (next_frame == animation->num_frames) {
+        next_frame = 0;
+    }
+    keyframe_animation_t temp_animation  = *animation;
+    temp_animation.current_frame         = next_frame;
+    temp_animation.time_left_in_frame    = get_frame_length(animation, next_frame);
+    temp_animation.first_update_of_frame = true;
+    temp_animation.last_update_of_frame  = false;
+    temp_animation.need_update           = false;
+    visualizer_state_t temp_state        = *state;
+    (*get_frame_function(animation, next_frame))(&temp_animation, &temp_state);
+}
+
+// TODO: Optimize the stack size, this is probably way too big
+static DECLARE_THREAD_STACK(visualizerThreadStack, 1024);
+static DECLARE_THREAD_FUNCTION(visualizerThread, arg) {
+    (void)arg;
+
+    GListener event_listener;
+    geventListenerInit(&event_listener);
+    geventAttachSource(&event_listener, (GSourceHandle)&current_status, 0);
+
+    visualizer_keyboard_status_t initial_status = {
+        .default_layer = 0xFFFFFFFF,
+        .layer         = 0xFFFFFFFF,
+        .mods          = 0xFF,
+        .leds          = 0xFFFFFFFF,
+        .suspended     = false,
+#ifdef BACKLIGHT_ENABLE
+        .backlight_level = 0,
+#endif
+#ifdef VISUALIZER_USER_DATA_SIZE
+        .user_data = {0},
+#endif
+    };
+
+    visualizer_state_t state = {.status = initial_status, .current_lcd_color = 0,
+#if defined(LCD_ENABLE) && !defined(VISUALIZER_LAZY_FONTS)
+                                .font_fixed5x8         = gdispOpenFont("fixed_5x8"),
+                                .font_dejavusansbold12 = gdispOpenFont("DejaVuSansBold12")
+#endif
+    };
+    initialize_user_visualizer(&state);
+    state.prev_lcd_color = state.current_lcd_color;
+
+#ifdef LCD_BACKLIGHT_ENABLE
+    lcd_backlight_color(LCD_HUE(state.current_lcd_color), LCD_SAT(state.current_lcd_color), LCD_INT(state.current_lcd_color));
+#endif
+
+    systemticks_t sleep_time   = TIME_INFINITE;
+    systemticks_t current_time = gfxSystemTicks();
+    bool          force_update = true;
+
+    while (true) {
+        systemticks_t new_time = gfxSystemTicks();
+        systemticks_t delta    = new_time - current_time;
+        current_time           = new_time;
+        bool enabled           = visualizer_enabled;
+        status_snapshot_t published;
+        read_published_status(&published);
+        uint8_t changes = status_changes(&state.status, &published.status);
+        if (force_update || changes) {
+#if BACKLIGHT_ENABLE
+            if (published.status.backlight_level != state.status.backlight_level) {
+                if (published.status.backlight_level != 0) {
+                    gdispGSetPowerMode(LED_DISPLAY, powerOn);
+                    uint16_t percent = (uint16_t)published.status.backlight_level * 100 / BACKLIGHT_LEVELS;
+                    gdispGSetBacklight(LED_DISPLAY, percent);
+                } else {
+                    gdispGSetPowerMode(LED_DISPLAY, powerOff);
+                }
+                state.status.backlight_level = published.status.backlight_level;
+            }
+#endif
+            if (visualizer_enabled) {
+                if (published.status.suspended) {
+                    stop_all_keyframe_animations();
+                    visualizer_enabled = false;
+                    state.status       = published.status;
+                    state.status_time  = published.time;
+                    user_visualizer_suspend(&state);
+                } else if (force_update || (changes & subscribed_fields)) {
+                    visualizer_keyboard_status_t prev_status = state.status;
+                    state.status                             = published.status;
+                    state.status_time                        = published.time;
+                    state.status_changes                     = force_update ? VISUALIZER_STATUS_ALL : changes;
+                    update_user_visualizer_state(&state, &prev_status);
+                } else {
+                    state.status      = published.status;
+                    state.status_time = published.time;
+                }
+                state.prev_lcd_color = state.current_lcd_color;
+            }
+            force_update = false;
+        }
+        if (!enabled && state.status.suspended && published.status.suspended == false) {
+            // Setting the status to the initial status will force an update
+            // when the visualizer is enabled again
+            state.status           = initial_status;
+            state.status.suspended = false;
+            stop_all_keyframe_animations();
+            user_visualizer_resume(&state);
+            state.prev_lcd_color = state.current_lcd_color;
+        }
+        sleep_time = TIME_INFINITE;
+        update_keyframe_animations(&state, delta, &sleep_time);
+
+        // Everything drawn during this update goes out to the displays at once
+        user_visualizer_flush(&state);
+#ifdef BACKLIGHT_ENABLE
+        gdispGFlush(LED_DISPLAY);
+#endif
+
+#ifdef LCD_ENABLE
+        gdispGFlush(LCD_DISPLAY);
+#endif
+
+#ifdef EMULATOR
+        draw_emulator();
+#endif
+        // Enable the visualizer when the startup or the suspend animation has finished
+        if (!visualizer_enabled && state.status.suspended == false && get_num_running_animations() == 0) {
+            visualizer_enabled = true;
+            force_update       = true;
+            sleep_time         = 0;
+        }
+
+        systemticks_t after_update = gfxSystemTicks();
+        unsigned      update_delta = after_update - current_time;
+        if (sleep_time != TIME_INFINITE) {
+            if (sleep_time > update_delta) {
+                sleep_time -= update_delta;
+            } else {
+                sleep_time = 0;
+            }
+        }
+        dprintf("Update took %d, last delta %d, sleep_time %d\n", update_delta, delta, sleep_time);
+#ifdef PROTOCOL_CHIBIOS
+        // The gEventWait function really takes milliseconds, even if the documentation says ticks.
+        // Unfortunately there's no generic ugfx conversion from system time to milliseconds,
+        // so let's do it in a platform dependent way.
+
+        // On windows the system ticks is the same as milliseconds anyway
+        if (sleep_time != TIME_INFINITE) {
+            sleep_time = TIME_I2MS(sleep_time);
+        }
+#endif
+        geventEventWait(&event_listener, sleep_time);
+    }
+#ifdef LCD_ENABLE
+    if (state.font_fixed5x8) {
+        gdispCloseFont(state.font_fixed5x8);
+    }
+    if (state.font_dejavusansbold12) {
+        gdispCloseFont(state.font_dejavusansbold12);
+    }
+#endif
+
+    return 0;
+}
+
+void visualizer_init(void) {
+    gfxInit();
+
+#ifdef LCD_BACKLIGHT_ENABLE
+    lcd_backlight_init();
+#endif
+
+#ifdef SERIAL_LINK_ENABLE
+    add_remote_objects(remote_objects, sizeof(remote_objects) / sizeof(remote_object_t*));
+#endif
+
+#ifdef LCD_ENABLE
+    LCD_DISPLAY = get_lcd_display();
+#endif
+
+#ifdef BACKLIGHT_ENABLE
+    LED_DISPLAY = get_led_display();
+#endif
+
+    // The thread reads the initial status from the snapshot
+    publish_status();
+
+    // We are using a low priority thread, the idea is to have it run only
+    // when the main thread is sleeping during the matrix scanning
+    gfxThreadCreate(visualizerThreadStack, sizeof(visualizerThreadStack), VISUALIZER_THREAD_PRIORITY, visualizerThread, NULL);
+}
+
+void visualizer_set_subscriptions(uint8_t fields) { subscribed_fields = fields; }
+
+#ifdef LCD_ENABLE
+gFont visualizer_get_font_fixed5x8(visualizer_state_t* state) {
+    if (!state->font_fixed5x8) {
+        state->font_fixed5x8 = gdispOpenFont("fixed_5x8");
+    }
+    return state->font_fixed5x8;
+}
+
+gFont visualizer_get_font_dejavusansbold12(visualizer_state_t* state) {
+    if (!state->font_dejavusansbold12) {
+        state->font_dejavusansbold12 = gdispOpenFont("DejaVuSansBold12");
+    }
+    return state->font_dejavusansbold12;
+}
+#endif
+
+// changes are the VISUALIZER_STATUS_ fields of current_status that changed
+void update_status(uint8_t changes) {
+    if (changes) {
+        publish_status();
+    }
+    if (changes & (subscribed_fields | visualizer_fields)) {
+        GSourceListener* listener = geventGetSourceListener((GSourceHandle)&current_status, NULL);
+        if (listener) {
+            geventSendEvent(listener);
+        }
+    }
+#ifdef SERIAL_LINK_ENABLE
+    static visualizer_keyboard_status_t sent_status;
+    static bool                         sent_keyframe = false;
+    static systime_t                    last_keyframe = 0;
+
+    systime_t current_update = chVTGetSystemTimeX();
+    uint8_t   parts          = changed_status_parts(&sent_status, &current_status);
+    if (!sent_keyframe || current_update - last_keyframe > TIME_MS2I(VISUALIZER_STATUS_KEYFRAME_MS)) {
+        sent_keyframe = true;
+        last_keyframe = current_update;
+        parts         = STATUS_PART_ALL;
+    }
+    if (parts) {
+        sent_status = current_status;
+        send_status_parts(parts);
+    }
+#endif
+}
+
+uint8_t visualizer_get_mods() {
+    uint8_t mods = get_mods();
+
+#ifndef NO_ACTION_ONESHOT
+    if (!has_oneshot_mods_timed_out()) {
+        mods |= get_oneshot_mods();
+    }
+#endif
+    return mods;
+}
+
+#ifdef VISUALIZER_USER_DATA_SIZE
+void visualizer_set_user_data(void* u) { memcpy(user_data, u, VISUALIZER_USER_DATA_SIZE); }
+#endif
+
+void visualizer_update(layer_state_t default_state, layer_state_t state, uint8_t mods, uint32_t leds) {
+    // The visualizer thread only sees the new status once update_status
+    // publishes it, see publish_status
+
+    uint8_t changes = 0;
+#ifdef SERIAL_LINK_ENABLE
+    if (is_serial_link_connected()) {
+        visualizer_keyboard_status_t new_status = current_status;
+        systemticks_t                new_time;
+        if (receive_status(&new_status, &new_time)) {
+            changes = status_changes(&current_status, &new_status);
+        }
+        if (changes) {
+            current_status      = new_status;
+            current_status_time = new_time;
+        }
+    } else {
+#else
+    {
+#endif
+        visualizer_keyboard_status_t new_status = {
+            .layer         = state,
+            .default_layer = default_state,
+            .mods          = mods,
+            .leds          = leds,
+#ifdef BACKLIGHT_ENABLE
+            .backlight_level = current_status.backlight_level,
+#endif
+            .suspended = current_status.suspended,
+        };
+#ifdef VISUALIZER_USER_DATA_SIZE
+        memcpy(new_status.user_data, user_data, VISUALIZER_USER_DATA_SIZE);
+#endif
+        changes = status_changes(&current_status, &new_status);
+        if (changes) {
+            current_status      = new_status;
+            current_status_time = gfxSystemTicks();
+        }
+    }
+    update_status(changes);
+}
+
+void visualizer_suspend(void) {
+    current_status.suspended = true;
+    current_status_time      = gfxSystemTicks();
+    update_status(VISUALIZER_STATUS_SUSPENDED);
+}
+
+void visualizer_resume(void) {
+    current_status.suspended = false;
+    current_status_time      = gfxSystemTicks();
+    update_status(VISUALIZER_STATUS_SUSPENDED);
+}
+
+#ifdef BACKLIGHT_ENABLE
+void backlight_set(uint8_t level) {
+    current_status.backlight_level = level;
+    current_status_time            = gfxSystemTicks();
+    update_status(VISUALIZER_STATUS_BACKLIGHT);
+}
+#endif
@@ -63,8 +63,13 @@ GDisplay* get_led_display(void);
 void draw_emulator(void);
 #endif
 
-// If you need support for more than 16 keyframes per animation, you can change this
-#define MAX_VISUALIZER_KEY_FRAMES 32
+// If you need support for more than 32 keyframes per animation, define this in
+// your config.h. Every animation pays for all of them though, so longer
+// animations are better described as runs of frames, see keyframe_run_t, and
+// keymaps that only use short ones can define it lower
+#ifndef MAX_VISUALIZER_KEY_FRAMES
+#    define MAX_VISUALIZER_KEY_FRAMES 32
+#endif
 
 struct keyframe_animation_t;
 
@@ -82,6 +87,19 @@ typedef struct {
 #endif
 } visualizer_keyboard_status_t;
 
+// The fields of visualizer_keyboard_status_t, as used by
+// visualizer_set_subscriptions and visualizer_state_t.status_changes
+enum {
+    VISUALIZER_STATUS_LAYER         = 1 << 0,
+    VISUALIZER_STATUS_DEFAULT_LAYER = 1 << 1,
+    VISUALIZER_STATUS_MODS          = 1 << 2,
+    VISUALIZER_STATUS_LEDS          = 1 << 3,
+    VISUALIZER_STATUS_SUSPENDED     = 1 << 4,
+    VISUALIZER_STATUS_BACKLIGHT     = 1 << 5,
+    VISUALIZER_STATUS_USER_DATA     = 1 << 6,
+    VISUALIZER_STATUS_ALL           = (1 << 7) - 1,
+};
+
 // The state struct is used by the various keyframe functions
 // It's also used for setting the LCD color and layer text
 // from the user customized code
@@ -92,6 +110,13 @@ typedef struct visualizer_state_t {
 
     // The user visualizer(and animation functions) can read these
     visualizer_keyboard_status_t status;
+    // When the status changed. On a slave that's when the master saw the
+    // change, converted to the slave's ticks, so that both halves can run
+    // their animations from the same tick.
+    systemticks_t status_time;
+    // The fields that differ from prev_status in update_user_visualizer_state,
+    // everything when the visualizer starts over after booting or resuming
+    uint8_t status_changes;
 
     // These are used by the animation functions
     uint32_t current_lcd_color;
@@ -107,15 +132,32 @@ typedef struct visualizer_state_t {
 // update per frame
 typedef bool (*frame_func)(struct keyframe_animation_t*, visualizer_state_t*);
 
+// Describes repeat frames in a row that all have the same length and function
+typedef struct {
+    int        length;
+    frame_func function;
+    int        repeat;
+} keyframe_run_t;
+
 // Represents a keyframe animation, so fields are internal to the system
 // while others are meant to be initialized by the user code
 typedef struct keyframe_animation_t {
     // These should be initialized
     int        num_frames;
     bool       loop;
+    // Higher priorities are updated after, and so draw on top of, lower ones.
+    // When there are too many animations running, starting one stops the
+    // running one with the lowest priority, if that's lower than its own.
+    uint8_t    priority;
     int        frame_lengths[MAX_VISUALIZER_KEY_FRAMES];
     frame_func frame_functions[MAX_VISUALIZER_KEY_FRAMES];
 
+    // Or, instead of frame_lengths and frame_functions, the frames can be
+    // described as runs. num_frames is then set by start_keyframe_animation,
+    // and isn't limited by MAX_VISUALIZER_KEY_FRAMES
+    const keyframe_run_t* runs;
+    int                   num_runs;
+
     // Used internally by the system, and can also be read by
     // keyframe update functions
     int  current_frame;
@@ -129,6 +171,8 @@ typedef struct keyframe_animation_t {
 extern GDisplay* LCD_DISPLAY;
 extern GDisplay* LED_DISPLAY;
 
+// Starting an animation that is already running makes it start over from
+// the first frame, there's no need to stop it first
 void start_keyframe_animation(keyframe_animation_t* animation);
 void stop_keyframe_animation(keyframe_animation_t* animation);
 // This runs the next keyframe, but does not update the animation state
@@ -140,6 +184,20 @@ void run_next_keyframe(keyframe_animation_t* animation, visualizer_state_t* stat
 void visualizer_set_user_data(void* user_data);
 #endif
 
+// Only changes to these fields of the status call update_user_visualizer_state,
+// changes to the others don't even wake up the visualizer thread. By default
+// everything is subscribed to. This is best called from
+// initialize_user_visualizer
+void visualizer_set_subscriptions(uint8_t fields);
+
+#ifdef LCD_ENABLE
+// The fonts of the state, opened the first time they are asked for. With
+// VISUALIZER_LAZY_FONTS defined that's the only time they are opened, the
+// state starts out without them, otherwise they are opened at startup.
+gFont visualizer_get_font_fixed5x8(visualizer_state_t* state);
+gFont visualizer_get_font_dejavusansbold12(visualizer_state_t* state);
+#endif
+
 // These functions have to be implemented by the user
 // Called regularly each time the state has changed (but not every scan loop)
 void update_user_visualizer_state(visualizer_state_t* state, visualizer_keyboard_status_t* prev_status);
@@ -152,3 +210,7 @@ void user_visualizer_suspend(visualizer_state_t* state);
 void initialize_user_visualizer(visualizer_state_t* state);
 // Called when the computer resumes from a suspend
 void user_visualizer_resume(visualizer_state_t* state);
+// Optional, called once per update after all animations have run, right
+// before the displays are flushed. Anything the user code buffers while
+// drawing should be written to the displays here
+void user_visualizer_flush(visualizer_state_t* state);
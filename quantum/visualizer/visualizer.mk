@@ -66,18 +66,8 @@ ifeq ($(strip $(LCD_ENABLE)), yes)
     endif
 # Note, that the linker will strip out any resources that are not actually in use
 SRC += $(VISUALIZER_DIR)/resources/lcd_logo.c
-SRC += $(VISUALIZER_DIR)/resources/logo-win.c
-SRC += $(VISUALIZER_DIR)/resources/logo-mac.c
-SRC += $(VISUALIZER_DIR)/resources/logo-cod.c
-SRC += $(VISUALIZER_DIR)/resources/mode-mode.c
-SRC += $(VISUALIZER_DIR)/resources/mode-cod.c
-SRC += $(VISUALIZER_DIR)/resources/mode-fn.c
-SRC += $(VISUALIZER_DIR)/resources/name-win.c
-SRC += $(VISUALIZER_DIR)/resources/name-mac.c
-SRC += $(VISUALIZER_DIR)/resources/name-gam.c
-SRC += $(VISUALIZER_DIR)/resources/name-cod.c
-SRC += $(VISUALIZER_DIR)/resources/symbol-keyboard.c
-SRC += $(VISUALIZER_DIR)/resources/symbol-controller.c
+# Generated from the images in resources/images, see the visualizer-resources target below
+SRC += $(VISUALIZER_DIR)/resources/resources.c
 
 $(eval $(call ADD_DRIVER,LCD))
 endif
@@ -132,7 +122,56 @@ else
 endif
 
 SRC += $(KEYMAP_PATH)/animation-keyframes.c
+SRC += $(KEYMAP_PATH)/dirty-regions.c
+SRC += $(KEYMAP_PATH)/lcd-framebuffer.c
+SRC += $(KEYMAP_PATH)/visualizer-stats.c
+
+# Precomputed element deltas, see ElementDeltas in animation-keyframes.c. Set
+# VISUALIZER_ELEMENT_DELTAS = no to draw every frame from the bitmaps instead.
+ifneq ($(strip $(VISUALIZER_ELEMENT_DELTAS)), no)
+    ifneq ("$(wildcard $(KEYMAP_PATH)/element-deltas.h)","")
+        OPT_DEFS += -DELEMENT_DELTAS_ENABLE
+    endif
+endif
+
+# The keymap's gaming layers snap onto the screen and leave the leds alone, see
+# LayerDisplayPolicies in animation-keyframes.c. Set VISUALIZER_GAMING_MODE = no
+# to have them slide like every other layer.
+ifneq ($(strip $(VISUALIZER_GAMING_MODE)), no)
+    OPT_DEFS += -DGAMING_MODE_ENABLE
+endif
+
+# Regenerates resources/resources.c and resources/resources.h from the images
+# in resources/images, checking their sizes against the keymap's elements, and
+# the keymap's element-deltas.h from both. The fonts in resources/fonts only
+# keep the glyphs of the keymap's layer_text strings. The generated files are checked in,
+# so python is only needed when an image or an element changes. Defining it
+# mustn't change the default goal of the build.
+VISUALIZER_DEFAULT_GOAL := $(.DEFAULT_GOAL)
+.PHONY: visualizer-resources
+visualizer-resources:
+	python3 $(VISUALIZER_DIR)/resources/generate-resources.py \
+		--elements $(KEYMAP_PATH)/animation-keyframes.c \
+		--deltas $(KEYMAP_PATH)/element-deltas.h \
+		--fonts $(VISUALIZER_DIR)/resources/fonts \
+		--text $(KEYMAP_PATH)/visualizer.c \
+		$(VISUALIZER_DIR)/resources/images $(VISUALIZER_DIR)/resources
+.DEFAULT_GOAL := $(VISUALIZER_DEFAULT_GOAL)
+
+# The uGFX fonts are opened at startup, keyframes like
+# lcd_keyframe_display_layer_text read them from the state directly. A keymap
+# whose keyframes only get them through visualizer_get_font_* can set
+# VISUALIZER_LAZY_FONTS = yes in its rules.mk, they are then only opened if
+# something asks for them.
+ifeq ($(strip $(VISUALIZER_LAZY_FONTS)), yes)
+    OPT_DEFS += -DVISUALIZER_LAZY_FONTS
+endif
 
 ifdef EMULATOR
 UINCDIR += $(TMK_DIR)/common
+# The emulator reports what every animation update costs
+OPT_DEFS += -DVISUALIZER_STATS_ENABLE
+else ifeq ($(strip $(VISUALIZER_STATS)), yes)
+# Counts the same on the board, the VSTATS keycode types them out
+OPT_DEFS += -DVISUALIZER_STATS_ENABLE
 endif